@@ -29,13 +29,38 @@
 
 
 // preprocessor directives
-#include <conio.h>
+#define _GNU_SOURCE // fopencookie, for the translated output of POSIX terminals
+
 #include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+
+#ifdef _WIN32
+#include <conio.h>
+#include <io.h>
 #include <windows.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING // missing from older headers
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#else // POSIX terminals, such as those of Linux
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define MAX_ROWS 10
 #define MAX_COLUMNS 15
@@ -43,9 +68,8 @@
 #define MAX_LEVELS 100
 #define MAX_RECORDS 10
 
-#define SHORT_SLEEP 500
+#define SHORT_SLEEP 500 // pauses of pace, in milliseconds
 #define LONG_SLEEP 1000
-#define BOARD_REFRESH 100
 
 #define ENTER_VALUE 13
 #define ESCAPE_VALUE 27
@@ -54,38 +78,549 @@
 #define DOWN_VALUE 80
 #define LEFT_VALUE 75
 #define RIGHT_VALUE 77
+#define DELETE_VALUE 83 // follows ARROW_VALUE, as the arrow keys do
+#define ESCAPE_TIMEOUT 25 // milliseconds to wait for the rest of an escape sequence from a terminal
+#define SCRIPT_LINE_SIZE 32 // longest key name in a batch script, plus its newline and one
 
 #define EASY_MODE "Classic->Easy"
 #define DIFFICULT_MODE "Classic->Difficult"
+#define EXPERT_MODE "Classic->Expert"
 #define CUSTOM_MODE "Custom"
+#define ENDLESS_MODE "Endless"
 
 #define WON_OUTCOME "Won"
 #define LOST_OUTCOME "Lost"
 #define QUIT_OUTCOME "Quit"
 
-#define PROFILES_DIRECTORY "profiles\\profiles.txt"
-#define LEADERBOARD_DIRECTORY "profiles\\leaderboard.txt"
-#define LEVELS_DIRECTORY "levels\\levels.txt"
+#ifdef _WIN32
+#define DIRECTORY_SEPARATOR "\\"
+#define NULL_DEVICE "NUL" // discards what is written to it
+#else
+#define DIRECTORY_SEPARATOR "/"
+#define NULL_DEVICE "/dev/null"
+#endif
+#define PROFILES_FOLDER "profiles" DIRECTORY_SEPARATOR
+#define LEVELS_FOLDER "levels" DIRECTORY_SEPARATOR
+#define PROFILES_DIRECTORY PROFILES_FOLDER "profiles.txt"
+#define LEADERBOARD_DIRECTORY PROFILES_FOLDER "leaderboard.txt"
+#define LEVELS_DIRECTORY LEVELS_FOLDER "levels.txt"
+#define REPLAY_SUFFIX "_replay.txt"
+#define JOURNAL_SUFFIX "_journal.txt"
+
+#define WORD_BITS 64
+#define NO_GUESS_ATTEMPTS 10000 // boards tried before a game settles for one that needs a guess
+#define SOLVER_MAX_COMPONENT 48 // frontier components with more cells are not enumerated
+#define SOLVER_MAX_STEPS 4096 // enumeration steps allowed per component before it is given up
+#define SOLVER_MAX_SOLVE_STEPS 6144 // enumeration steps shared by every component of one solve
+#define PROBABILITY_MAX_STEPS (1 << 18) // enumeration steps per component before it is sampled instead
+#define PROBABILITY_SAMPLE_TIME 20000 // microseconds spent sampling a component too large to enumerate
+#define UNDO_MAX_ACTIONS 4096 // actions kept for undoing; the older half is dropped past this
+#define JOURNAL_BATCH 8 // journaled actions buffered before they are forced to disk
+#define LIVE_TIMER_TICK 100 // milliseconds between updates of the clock shown during a game
+#define LIVE_TIMER_LABEL "Time: " // ends the header of a game; the clock is written after it
+
+#define EVADE_LINES 8 // lines printed by printEvade
+#define EVADE_TEXT_SIZE 4096 // longest text of printEvade, escapes included, plus one
+#define CLEAR_SEQUENCE "\x1b[H\x1b[2J\x1b[3J" // clears a terminal's screen and scrollback
+#define FRAME_TEXT_SIZE 512 // longest text kept above or below a drawn board, plus one
+#define GLYPH_FLAG 11 // glyphs of tiles that are not revealed; revealed tiles use their state
+#define GLYPH_HIDDEN 12
+#define FRAME_CURSOR 16 // added to the glyph of the tile under the cursor
+
+// ways a tile is drawn, each with its own entries in the glyph table
+#define TILE_BORDERED 0 // "|>x<", with the border on its left, as boards are drawn in full
+#define TILE_BORDERLESS 1 // ">x<", rewriting a tile of a board already drawn
+#define TILE_MARKERS 2 // ">" and "<" around a tile that is skipped over, when only the cursor moved
+#define TILE_DENSE 3 // "x", a single character; the tile under the cursor is in reverse
+#define NUM_TILE_STYLES 4
+#define NUM_TILE_CODES 32 // a tile's glyph (0 - 12), plus FRAME_CURSOR if the cursor is on it
+#define TILE_TEXT_SIZE 64 // longest text of a tile in the glyph table
+#define NUM_THEMES 4
+
+// screens whose inputs are timed until the frame answering them is drawn
+#define LATENCY_GAME_BOARD 0 // moving the cursor of a classic or custom game, or selecting a tile
+#define LATENCY_GAME_ACTION 1 // answering the action prompt under the board
+#define LATENCY_ENDLESS_BOARD 2
+#define LATENCY_ENDLESS_ACTION 3
+#define NUM_LATENCY_SCREENS 4
+#define LATENCY_EXACT 16 // latencies under this many microseconds have a bucket each
+#define LATENCY_STEPS 8 // buckets per doubling above LATENCY_EXACT, so each spans at most 1/8 of its values
+#define NUM_LATENCY_BUCKETS (LATENCY_EXACT + 32 * LATENCY_STEPS) // up to about 2^36 microseconds
+
+#define BENCH_SCREEN_ROWS 40 // size of the console that --bench-render fits its frames to
+#define BENCH_SCREEN_COLUMNS 120
+
+// phases of a simulated game, timed separately
+#define PHASE_GENERATE 0 // building the board at the first inspection
+#define PHASE_CHOOSE 1 // the bot choosing a tile
+#define PHASE_REVEAL 2 // inspecting the tile
+#define PHASE_CHECK 3 // checking if the game is over
+#define NUM_PHASES 4
+
+#define CHUNK_SIZE 32 // endless boards are generated in CHUNK_SIZE x CHUNK_SIZE chunks
+#define CHUNK_MINES 200 // mines per chunk, about as dense as an expert board
+#define ENDLESS_SIZE (1 << 30) // rows and columns of an endless board; far more than can be explored
+#define ENDLESS_VIEW_ROWS 10
+#define ENDLESS_VIEW_COLUMNS 15
 
 typedef char string20[21];
 typedef char string100[101];
+typedef unsigned long long bitword;
+
+#ifdef _WIN32
+typedef HANDLE threadHandle;
+typedef CRITICAL_SECTION threadLock;
+typedef CONDITION_VARIABLE threadCondition;
+#else
+typedef pthread_t threadHandle;
+typedef pthread_mutex_t threadLock;
+typedef pthread_cond_t threadCondition;
+#endif
 
-struct Tile {
-    int state;
-    int isFlagged;
-    int isRevealed;
+/*
+    The mines of a board, kept two ways: a bitplane answers "is this tile a mine?" in constant time,
+    and a dense list of flat indices lets the mines be visited without looking at any other tile.
+*/
+struct MineIndex {
+    bitword *plane;
+    int *cells; // flat indices of the mines, in no particular order
+    int numMines;
+    int cellCapacity; // number of indices cells can hold before it has to grow
 };
 
-struct Game {
-    int exists;
+/*
+    State of a xoshiro256** pseudorandom number generator. Every game seeds its own generator, so the
+    same seed always produces the same board.
+*/
+struct Random {
+    unsigned long long state[4];
+};
+
+/*
+    Tiles are addressed by their flat index (row * columns + column). Bit i of each plane belongs to
+    tile i; bits past the last tile are always 0, so whole words can be combined without masking.
+    The buffers live on the heap and are only reallocated when a board outgrows its capacity.
+*/
+struct Board {
     int rows;
     int columns;
-    struct Tile Board[MAX_ROWS][MAX_COLUMNS];
+    int capacity; // number of tiles the buffers can hold
+    struct MineIndex Mines;
+    bitword *revealedPlane;
+    bitword *flaggedPlane;
+    unsigned char *states; // 0 - 8 nearby mines, 9 - mine, 10 - exploded mine
+    int *workStack; // pending tiles of revealTiles, kept between calls so it is allocated only once
+    int workCapacity;
+    unsigned char *rowBuffer; // scratch rows of initializeTileStates, also kept between calls
+    int rowCapacity;
+
+    // kept up to date as tiles change so that getGameState never scans the board
+    int numHiddenSafe; // non-mine tiles that are not yet revealed
+    int explodedTile; // flat index of the inspected mine; -1 if no mine has been inspected
+};
+
+/*
+    A chunk of an endless board. Its mines come from the board's seed and the chunk's coordinates,
+    so a chunk is the same whenever it is generated. The counts along its edges depend on the
+    neighboring chunks, so they are only computed once a tile of the chunk is revealed.
+*/
+struct Chunk {
+    int chunkRow;
+    int chunkColumn;
+    int hasStates; // 1 once every tile's state counts the mines of the neighboring chunks too
+    struct Board Board;
+};
+
+/*
+    A board without a fixed size. Chunks are generated the first time they are touched and are
+    found through an open-addressing hash table of their coordinates, so memory grows with the
+    area explored rather than with the size of the board.
+*/
+struct EndlessBoard {
+    unsigned long long seed;
+
+    struct Chunk *chunks;
+    int numChunks;
+    int chunkCapacity;
+    int *table; // indices into chunks; -1 marks an empty slot
+    int tableSize; // always a power of 2
+
+    int *workStack; // pending tiles of revealEndlessTiles, stored as row and column pairs
+    int workCapacity;
+
+    int numRevealed;
+    int isExploded; // 1 once a mine has been inspected
+};
+
+/*
+    A revealed number seen as an equation over its neighbors: exactly numMines of its cells are
+    mines. Cells are the neighbors not yet known to be a mine or safe; known mines are subtracted
+    from numMines as they are found.
+*/
+struct Constraint {
+    int tile; // flat index of the revealed number
+    int cells[8];
+    int numCells;
+    int numMines;
+    int isQueued; // 1 while the constraint waits in the solver's queue
+    int component; // frontier component of the constraint; -1 until components are found
+    int isChanged; // 1 if its cells changed since its component was last enumerated
+
+    // kept while the constraint's component is enumerated
+    int numAssigned;
+    int numAssignedMines;
+};
+
+/*
+    Buffers of the logical solver, kept between positions so that they are allocated only once.
+    After a solve, safeCells and mineCells list everything it could deduce.
+*/
+struct Solver {
+    int capacity; // number of tiles the per-tile buffers can hold
+    bitword *minePlane; // tiles known to be mines (deduced, or flagged when flags are trusted)
+    bitword *safePlane; // hidden tiles deduced to be safe
+    bitword *savedFlags; // the player's flags, put back once a generated board has been verified
+    int *constraintOfTile; // index of the constraint of each revealed number; -1 for other tiles
+    int *slotOfTile; // position of each cell in componentCells; -1 for cells of other components
+
+    struct Constraint *constraints;
+    int numConstraints;
+    int constraintCapacity;
+    int *queue; // ring of the constraints waiting to be checked; never holds one twice
+    int queueStart;
+    int queueLength;
+    int isInconsistent; // 1 if no placement of mines agrees with the position
+
+    int *safeCells; // hidden tiles deduced to be safe, in the order they were found
+    int numSafe;
+    int *mineCells; // tiles deduced to be mines; flagged tiles only appear when flags are not trusted
+    int numMines;
+
+    // the frontier component being enumerated
+    int numComponents; // components found by the last solve
+    int *componentCells;
+    int numComponentCells;
+    int cellConstraints[SOLVER_MAX_COMPONENT][8]; // constraints each of the first cells appears in
+    int numCellConstraints[SOLVER_MAX_COMPONENT];
+    int assignment[SOLVER_MAX_COMPONENT]; // 1 - mine, 0 - safe, for the placement being built
+    int mineCounts[SOLVER_MAX_COMPONENT]; // placements in which each cell is a mine
+    int numPlacements;
+    int numSteps;
+    int maxSteps; // steps the component may take; lowered to numSteps when it is given up
+    int numStepsLeft; // steps the rest of the solve may take
+};
+
+/*
+    A fixed set of worker threads that run batches of independent tasks. The thread that starts a
+    batch works on it too and returns once every task is finished; a pool with no threads runs
+    every task on the calling thread.
+*/
+struct ThreadPool {
+    threadHandle *threads;
+    int numThreads;
+    threadLock lock; // guards every field below
+    threadCondition hasWork; // signalled when a batch starts or the pool stops
+    threadCondition isIdle; // signalled when the last task of a batch is finished
+
+    void (*task)(void *context, int index);
+    void *context;
+    int numTasks;
+    int nextTask;
+    int numFinished;
+    int isStopping;
+};
+
+/*
+    A cell of a frontier component, with the component's constraints it appears in.
+*/
+struct ComponentCell {
+    int tile; // flat index of the cell
+    int constraints[8];
+    int numConstraints;
+    int isMine; // value of the cell in the placement being built
+};
+
+/*
+    A constraint of a frontier component over the positions of its cells in the component.
+*/
+struct ComponentConstraint {
+    int slots[8];
+    int numSlots;
+    int numMines;
+    int numAssigned;
+    int numAssignedMines;
+};
+
+/*
+    An independent piece of the frontier, copied out of the solver so that it can be enumerated on
+    any thread. placements[k] weighs the placements of the component with k mines, and
+    mineWeights[j * (numCells + 1) + k] those among them in which cell j is a mine. Weights are
+    scaled so the largest placement weight is 1; only their ratios matter.
+*/
+struct Component {
+    struct ComponentCell *cells;
+    int numCells;
+    int cellCapacity;
+    struct ComponentConstraint *constraints;
+    int numConstraints;
+    int constraintCapacity;
+
+    double *placements;
+    double *mineWeights;
+    int weightCapacity;
+
+    int numPlaced; // mines in the placement being built
+    int numSteps;
+    int isExact; // 0 if the component was too large to enumerate and was sampled instead
+    struct Random Random; // only used when sampling
+};
+
+/*
+    The chance that each tile of a position is a mine, with the buffers used to compute it, kept
+    between positions so that they are allocated only once.
+*/
+struct ProbabilityMap {
+    int capacity; // number of tiles mineChance can hold
+    double *mineChance; // 0 for revealed tiles
+    int isExact; // 1 if no component had to be sampled
+
+    struct Component *components;
+    int numComponents;
+    int componentCapacity;
+
+    // weights by number of frontier mines, each numFrontier + 1 long
+    double *convolution;
+    double *scratch;
+    double *interiorWeights; // relative number of ways to place the remaining mines in the interior
+    int weightCapacity;
+};
+
+/*
+    Everything a bot needs to play games on one thread: its own board, solver, and random stream,
+    reused from game to game, and the totals of the games it has played.
+*/
+struct BotPlayer {
+    struct Board Board;
+    struct Solver Solver;
+    struct ProbabilityMap Map;
+    struct Random Random;
+    int nextSafe; // next of the solver's safe tiles to inspect
+
+    int numGames;
+    int numWon;
+    long long numMoves;
+    long long phaseNanoseconds[NUM_PHASES];
+};
+
+/*
+    A strategy for playing a game: chooseTile picks the next tile to inspect on the player's board.
+*/
+struct Bot {
+    char *name;
+    char *description;
+    int (*chooseTile)(struct BotPlayer *Player);
+};
+
+/*
+    A batch of simulated games, shared by the threads playing it. Each thread plays its share of
+    the games with its own player, so nothing is written by two threads while they play; the
+    players' totals are added up once all of them are done.
+*/
+struct Simulation {
+    struct Board *Level; // the custom level as loaded, which each player copies once; NULL for classic games
+    int rows; // dimensions and mines of classic games, which are generated at the first inspection
+    int columns;
+    int numMines;
+    struct Bot *Bot;
+    struct BotPlayer *Players;
+    int numPlayers;
+    int numGames;
+
+    // totals of every player
+    int numPlayed;
+    int numWon;
+    long long numMoves;
+    long long phaseNanoseconds[NUM_PHASES];
+};
+
+/*
+    Bytes of a frame being composed before they are written to the console all at once. The
+    buffer is kept between frames, so it only grows until it fits the largest frame.
+*/
+struct ScreenBuffer {
+    char *bytes;
+    int length;
+    int capacity;
+    int hasFailed; // 1 if memory ran out, so some bytes were dropped
+};
+
+/*
+    The window of a board that is drawn: as many tiles as fit on the console, scrolled so that the
+    cursor stays inside it. Boards that fit are drawn whole.
+*/
+struct Viewport {
+    int originRow; // the tile at the window's upper left
+    int originColumn;
+    int rows; // number of tiles shown down and across
+    int columns;
+    int labelWidth; // characters of the row numbers; at least 3
+    int isDense; // 1 if each tile is one character without borders; 0 for the bordered board
+};
+
+/*
+    The text of every tile, escapes included, composed once for every theme and way of drawing
+    it, so that drawing a tile is a lookup and a copy. Tiles are looked up by their code: the
+    glyph, plus FRAME_CURSOR if the cursor is on the tile.
+*/
+struct GlyphTable {
+    char text[NUM_THEMES][NUM_TILE_STYLES][NUM_TILE_CODES][TILE_TEXT_SIZE];
+    unsigned char length[NUM_THEMES][NUM_TILE_STYLES][NUM_TILE_CODES];
+    int isReady; // 1 once every text is composed
+};
+
+/*
+    The screen as last drawn by renderFrame: what each tile of the board shows and the text above
+    and below it. The next frame only rewrites the tiles that changed, placing the console's
+    cursor on each of them, instead of clearing the screen and printing everything again.
+*/
+struct Frame {
+    unsigned char *cells; // glyph of each tile in the window, plus FRAME_CURSOR on the tile under the cursor
+    int capacity; // number of tiles cells can hold
+    int rows; // size of the whole board
+    int columns;
+    int theme;
+    int isDrawn; // 0 if the screen was changed by something else, so the next frame is drawn in full
+    char header[FRAME_TEXT_SIZE]; // printed between the title and the board
+    char footer[FRAME_TEXT_SIZE]; // printed under the board; the console's cursor is left at its end
+
+    struct Viewport View; // the window drawn last
+    int screenRows; // size of the console the window is fitted to; 0 to ask the console at each frame
+    int screenColumns;
+
+    struct ScreenBuffer Buffer; // where each frame is composed
+    int frameBytes; // size of the last frame
+    long long buildMicroseconds; // time taken to compose the last frame
+};
+
+/*
+    A clock at the end of a game's header, kept current by a thread of its own that rewrites only
+    its field, so that the board is never drawn again for it. Frames of the game are written
+    while holding its lock, so the clock is never written into the middle of one.
+*/
+struct LiveTimer {
+    threadHandle thread;
+    int isStarted; // 0 if the thread could not be created, or nothing is drawn
+    threadLock lock; // guards every field below, and the console while the clock is shown
+    threadCondition wakeup; // signalled when the timer stops
+    long long startMicroseconds; // when the game started, counting the time played before a resume
+    int row; // where the field is on the console, from 1
+    int column;
+    int isShown; // 1 while the field is on the screen, so it may be written
+    int isStopping;
+};
+
+/*
+    Latencies from an input to the frame that answers it, counted in buckets whose width grows with
+    their latency, so that percentiles are read to within 1/LATENCY_STEPS without keeping samples.
+*/
+struct LatencyHistogram {
+    long long counts[NUM_LATENCY_BUCKETS];
+    long long numInputs;
+    long long totalMicroseconds;
+    long long maxMicroseconds;
+};
+
+struct LatencyTracker {
+    struct LatencyHistogram Screens[NUM_LATENCY_SCREENS];
+    long long inputMicroseconds; // when the last input was read; 0 once a frame has answered it
+    int inputScreen; // the screen the last input was read on
+};
+
+/*
+    What a batch session has done so far, summarized in its last line of results.
+*/
+struct BatchSession {
+    long long startMicroseconds;
+    int numInputs; // answers and keys read from the script
+    int numGames;
+    int numWon;
+    int numLost;
+    int numQuit;
+};
+
+struct Game {
+    int exists;
+    struct Board Board;
     string20 mode;
     string20 outcome;
     int seconds;
 };
 
+struct Action {
+    int tile; // flat index of the tile acted on
+    char type; // 'I' - inspect, 'F' - flag, 'R' - remove flag, 'Z' - undo, 'Y' - redo, 'Q' - quit
+    int milliseconds; // time since the start of the game
+};
+
+/*
+    An action that can be undone, kept as the tiles it changed: the tiles an inspection revealed,
+    or the single tile a flag was placed on or removed from. Its tiles are a slice of the history's
+    arena.
+*/
+struct UndoEntry {
+    char type; // 'I' - inspect, 'F' - flag, 'R' - remove flag
+    int start; // index of its first tile in the arena
+    int numTiles;
+};
+
+/*
+    The undo and redo stack of a game. Instead of a copy of the board per action, the tiles every
+    action changed are appended to one growable arena, so undoing or redoing an action costs only
+    the tiles it changed. Entries past numApplied were undone and can be redone until a new action
+    is taken. Each tile is revealed at most once along the stack, so the arena holds at most one
+    index per tile plus one per flag change, and only the last UNDO_MAX_ACTIONS actions are kept.
+*/
+struct UndoHistory {
+    int *tiles; // arena of the changed tiles of every entry, in order
+    int numTiles;
+    int tileCapacity;
+
+    struct UndoEntry *entries;
+    int numEntries;
+    int entryCapacity;
+    int numApplied; // entries currently applied to the board
+
+    int hasFailed; // 1 if memory ran out while recording the current entry
+};
+
+/*
+    Everything needed to play a game again: how its board was made and the actions taken on it,
+    in order. Classic boards are rebuilt from their seed and custom boards from their level file,
+    so no board is ever stored.
+*/
+struct ActionLog {
+    string20 mode;
+    string100 level; // name of the custom level; "-" for classic games
+    int rows;
+    int columns;
+    int numMines;
+    unsigned long long seed;
+
+    struct Action *actions;
+    int numActions;
+    int capacity;
+};
+
+/*
+    The journal of the game in progress: the header of its action log followed by one line per
+    action, appended as the game is played, so a game cut short by a crash can be replayed from
+    it. Lines are forced to disk every JOURNAL_BATCH actions rather than after each one.
+*/
+struct Journal {
+    FILE *fp; // NULL if the journal could not be opened; the game goes on without one
+    int numPending; // actions written since the journal was last forced to disk
+};
+
 struct Stats {
     int totalSeconds;
     int won;
@@ -303,51 +838,70 @@ void printEnd(int theme) {
 
 
 /*
-	@brief: prints the "evade the mine" ASCII
+	@brief: composes the "evade the mine" ASCII, so that it can be printed or added to a frame
 
+    @param: text - where the ASCII is written; holds EVADE_TEXT_SIZE characters
     @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
 
+    @return: the number of characters written
+
     Precondition: assumes theme is between 1 to 4, inclusive
 */
-void printEvade(int theme) {
-    printf("\n");
+int composeEvade(char text[], int theme) {
+    int length = snprintf(text, EVADE_TEXT_SIZE, "\n");
 
     if (theme == 1) { // cyan
-        printf ("                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
-        printf ("\x1b[1m\x1b[36m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
-        printf ("\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
-        printf ("\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[36m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
-        printf ("                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[36m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[36m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
     }
     else if (theme == 2) { // bright red
-        printf ("                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
-        printf ("\x1b[1m\x1b[31m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
-        printf ("\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
-        printf ("\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[31m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
-        printf ("                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[31m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[31m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
     }
     else if (theme == 3) { // bright green
-        printf ("                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
-        printf ("\x1b[1m\x1b[32m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
-        printf ("\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
-        printf ("\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[32m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
-        printf ("                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[32m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[32m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
     }
     else if (theme == 4) { // dark purple
-        printf ("                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
-        printf ("\x1b[1m\x1b[35m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
-        printf ("\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
-        printf ("\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
-        printf ("\x1b[1m\x1b[35m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
-        printf ("                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                            \x1b[1m\x1b[31m_------*\x1b[0m\n");
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[35m   %c%c%c%c%c %c%c   %c%c %c%c%c%c%c%c%c%c %c%c%c%c%c  %c%c%c%c%c%c     %c%c%c%c%c%c %c%c  %c%c %c%c%c%c%c\x1b[0m           \x1b[1m\x1b[31m_/ \x1b[0m\n", 219, 219, 223, 223, 223, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 220, 219, 219, 223, 223, 223, 223, 223, 223, 219, 219, 223, 223, 219, 219, 219, 219, 219, 219, 223, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c    %c%c   %c%c %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m             \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[37m   %c%c%c%c  %c%c%c %c%c%c %c%c%c%c%c%c%c%c %c%c   %c %c%c%c%c         %c%c   %c%c%c%c%c%c %c%c%c%c\x1b[0m          \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 223, 223, 219, 220, 220, 219, 223, 219, 219, 223, 223, 223, 223, 219 ,219, 219, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223, 219, 219, 219, 219, 223, 223);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[33m   %c%c     %c%c %c%c  %c%c    %c%c %c%c  %c%c %c%c           %c%c   %c%c  %c%c %c%c\x1b[0m           \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 223, 219, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "\x1b[1m\x1b[35m   %c%c%c%c%c   %c%c%c   %c%c    %c%c %c%c%c%c%c  %c%c%c%c%c%c       %c%c   %c%c  %c%c %c%c%c%c%c\x1b[0m       \x1b[1m\x1b[31m/ / \x1b[0m\n", 219, 219, 220, 220, 220, 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 219, 223, 219, 219, 220, 220, 220, 220, 219, 219, 219, 219, 219 ,219, 219, 219, 220, 220, 220);
+        length += snprintf(text + length, EVADE_TEXT_SIZE - length, "                                                                     \x1b[1m\x1b[31m(_)\x1b[0m\n");
     }
+    return length;
+}
+
+
+/*
+	@brief: prints the "evade the mine" ASCII
+
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: assumes theme is between 1 to 4, inclusive
+*/
+void printEvade(int theme) {
+    char text[EVADE_TEXT_SIZE];
+
+    composeEvade(text, theme);
+    printf("%s", text);
 }
 
 
@@ -364,2318 +918,9058 @@ int getDateCode() {
 
 
 /*
-	@brief: updates the current profile struct's statistics based on the current game outcome
-	
-	@param: CurrentProfile - pointer to the current profile structure holding profile information
-	
-	Precondition: assumes a game has recently concluded
-*/
-void updateStatistics(struct Profile *CurrentProfile) {
-    string20 mode;
-    strcpy(mode, CurrentProfile->CurrentGame.mode);
-    int seconds = CurrentProfile->CurrentGame.seconds;
+	@brief: reads the high-resolution monotonic clock
 
-    if (strcmp(CurrentProfile->CurrentGame.outcome, WON_OUTCOME) == 0) { // won
-        if (strcmp(mode, EASY_MODE) == 0) {
-            CurrentProfile->EasyStats.won++;
-            CurrentProfile->EasyStats.totalSeconds += seconds;
-        }
-        else if (strcmp(mode, DIFFICULT_MODE) == 0) {
-            CurrentProfile->DifficultStats.won++;
-            CurrentProfile->DifficultStats.totalSeconds += seconds;
-        }
-        else if (strcmp(mode, CUSTOM_MODE) == 0) {
-            CurrentProfile->CustomStats.won++;
-            CurrentProfile->CustomStats.totalSeconds += seconds;
-        }
-    }
-    else { // lost/quit
-        if (strcmp(mode, EASY_MODE) == 0) {
-            CurrentProfile->EasyStats.lost++;
-        }
-        else if (strcmp(mode, DIFFICULT_MODE) == 0) {
-            CurrentProfile->DifficultStats.lost++;
-        }
-        else if (strcmp(mode, CUSTOM_MODE) == 0) {
-            CurrentProfile->CustomStats.lost++;
-        }
-    }
+	@return: microseconds elapsed since an arbitrary, fixed starting point
+*/
+long long getMicroseconds() {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    // split the conversion so that the multiplication cannot overflow
+    return counter.QuadPart / frequency.QuadPart * 1000000 +
+        counter.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+#endif
 }
 
 
 /*
-	@brief: updates the current profile's struct's recent games
-	
-	@param: CurrentProfile - pointer to the current profile structure holding profile information
-	
-	Precondition: assumes a game has recently concluded
-*/
-void updateRecentGames(struct Profile *CurrentProfile) {
-    int i, j;
+	@brief: reads the high-resolution monotonic clock with a finer unit, for timing short steps
 
-    // set recent game 3's details to that of recent game 2's
-    if (CurrentProfile->RecentGame2.exists) {
-        CurrentProfile->RecentGame3 = CurrentProfile->RecentGame2;
-    }
+	@return: nanoseconds elapsed since an arbitrary, fixed starting point
+*/
+long long getNanoseconds() {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
 
-    // set recent game 2's details to that of recent game 1's
-    if (CurrentProfile->RecentGame1.exists) {
-        CurrentProfile->RecentGame2 = CurrentProfile->RecentGame1;
-    }
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
 
-    // set recent game 1's details to that of the current game's
-    if (CurrentProfile->CurrentGame.exists) {
-        CurrentProfile->RecentGame1 = CurrentProfile->CurrentGame;
+    return counter.QuadPart / frequency.QuadPart * 1000000000 +
+        counter.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart;
+#else
+    struct timespec now;
 
-        // reset current board's details
-        CurrentProfile->CurrentGame.rows = 0;
-        CurrentProfile->CurrentGame.columns = 0;
-        for (i = 0; i < MAX_ROWS; i++) {
-            for (j = 0; j < MAX_COLUMNS; j++) {
-                CurrentProfile->CurrentGame.Board[i][j].state = 0;
-                CurrentProfile->CurrentGame.Board[i][j].isFlagged = 0;
-                CurrentProfile->CurrentGame.Board[i][j].isRevealed = 0;
-            }
-        }
-        strcpy(CurrentProfile->CurrentGame.mode, "");
-        strcpy(CurrentProfile->CurrentGame.outcome, "");
-        CurrentProfile->CurrentGame.seconds = 0;
-    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+#endif
 }
 
 
 /*
-	@brief: converts a tile into a 3-4 digit code for storing information
-	
-	@param: row - the row of the tile
-	@param: column - the column of the tile
-	@param: Board - a 2-dimensional array of tiles representing the board where the tile belongs
-	
-	@return: 3-4 digit integer representing the tile's code
+	@brief: reads the processor time used by the calling thread, which unlike the monotonic clock
+		does not advance while the thread waits for a processor
 
-    Precondition: assumes row and column are not out of bounds
+	@return: microseconds the calling thread has run for
 */
-int getTileCode(int row, int column, struct Tile Board[][MAX_COLUMNS]) {
-    int code = 0;
-    code += Board[row][column].state * 100;
-    code += Board[row][column].isFlagged * 10;
-    code += Board[row][column].isRevealed;
-    return code;
+long long getThreadMicroseconds() {
+#ifdef _WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+
+    GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime);
+
+    // both times count 100 nanosecond intervals
+    return (((long long) kernelTime.dwHighDateTime << 32 | kernelTime.dwLowDateTime) +
+        ((long long) userTime.dwHighDateTime << 32 | userTime.dwLowDateTime)) / 10;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+#endif
 }
 
 
-/*
-	@brief: access the current profile's text file and update it in accordance with the struct's
-        contents
-	
-	@param: CurrentProfile - pointer to the current profile struct that we will be using to update
-        their text file
+// 1 if the screens pause between steps for messages and animations; turned off with --no-pacing
+static int isPacing = 1;
 
-    Precondition: the current profile name corresponds with the actual profile being updated
-*/	
-void updateProfile(struct Profile *CurrentProfile) {
-    FILE *fp;
-    int i, j;
+// 1 if games draw their boards one character per tile, without borders; turned on with --dense
+static int isDenseBoard = 0;
 
-    string100 directory = "profiles\\";
-    strcat(directory, CurrentProfile->name);
-    strcat(directory, ".txt");
+// the text of every tile; composed at startup by prepareGlyphTable
+static struct GlyphTable Glyphs;
 
-    updateStatistics(CurrentProfile);
-    updateRecentGames(CurrentProfile);
+// 1 if the menus are answered from a script and nothing is drawn; turned on with --batch
+static int isBatch = 0;
 
-    fp = fopen(directory, "w");
-    if (fp == NULL) return;
+// where a batch session writes its results, one line per event; the screens go to NULL_DEVICE
+static FILE *resultsFile = NULL;
 
-    struct Game *RecentGame1 = &CurrentProfile->RecentGame1;
-    struct Game *RecentGame2 = &CurrentProfile->RecentGame2;
-    struct Game *RecentGame3 = &CurrentProfile->RecentGame3;
+static struct BatchSession Batch;
 
-    // player information and statistics
-    fprintf(fp, "%s\n%d\n%d\n\n", CurrentProfile->name, CurrentProfile->creationDate, CurrentProfile->lifetimeGames);
-    fprintf(fp, "%d\n%d\n%d\n\n", CurrentProfile->EasyStats.totalSeconds, CurrentProfile->EasyStats.won,
-        CurrentProfile->EasyStats.lost);
-    fprintf(fp, "%d\n%d\n%d\n\n", CurrentProfile->DifficultStats.totalSeconds, CurrentProfile->DifficultStats.won,
-        CurrentProfile->DifficultStats.lost);
-    fprintf(fp, "%d\n%d\n%d\n\n", CurrentProfile->CustomStats.totalSeconds, CurrentProfile->CustomStats.won,
-        CurrentProfile->CustomStats.lost);
+// latencies of the inputs on every screen so far; the report is printed on exit with --latency
+static struct LatencyTracker Latency;
+static int isReportingLatency = 0;
 
-    // recent game 1
-    fprintf(fp, "%d\n", RecentGame1->exists);
-    if (RecentGame1->exists) {
-        fprintf(fp, "%d %d\n", RecentGame1->rows, RecentGame1->columns);
-        for (i = 0; i < RecentGame1->rows; i++) {
-            for (j = 0; j < RecentGame1->columns; j++) {
-                fprintf(fp, "%d ", getTileCode(i, j, RecentGame1->Board));
-            }
-            fprintf(fp, "\n");
-        }
-        fprintf(fp, "%s\n%s\n", RecentGame1->mode, RecentGame1->outcome);
-        fprintf(fp, "%d\n", RecentGame1->seconds);
-    }
+// 1 if every seed is drawn from fixedSeed rather than the clock; turned on with --seed
+static int isSeeded = 0;
+static unsigned long long fixedSeed = 0;
 
-    // recent game 2
-    fprintf(fp, "\n%d\n", RecentGame2->exists);
-    if (RecentGame2->exists) {
-        fprintf(fp, "%d %d\n", RecentGame2->rows, RecentGame2->columns);
-        for (i = 0; i < RecentGame2->rows; i++) {
-            for (j = 0; j < RecentGame2->columns; j++) {
-                fprintf(fp, "%d ", getTileCode(i, j, RecentGame2->Board));
-            }
-            fprintf(fp, "\n");
-        }
-        fprintf(fp, "%s\n%s\n", RecentGame2->mode, RecentGame2->outcome);
-        fprintf(fp, "%d\n", RecentGame2->seconds);
-    }
 
-    // recent game 3
-    fprintf(fp, "\n%d\n", RecentGame3->exists);
-    if (RecentGame3->exists) {
-        fprintf(fp, "%d %d\n", RecentGame3->rows, RecentGame3->columns);
-        for (i = 0; i < RecentGame3->rows; i++) {
-            for (j = 0; j < RecentGame3->columns; j++) {
-                fprintf(fp, "%d ", getTileCode(i, j, RecentGame3->Board));
-            }
-            fprintf(fp, "\n");
-        }
-        fprintf(fp, "%s\n%s\n", RecentGame3->mode, RecentGame3->outcome);
-        fprintf(fp, "%d\n", RecentGame3->seconds);
-    }
+#ifndef _WIN32
+// 1 once stdout converts the code page 437 characters of the screens into UTF-8
+static int isTranslating = 0;
 
-    fclose(fp);
-}
+// settings of the terminal before it was switched to single keys; put back on exit or when killed
+static struct termios LineInput;
+static volatile sig_atomic_t isRawInput = 0;
+
+// the characters 128 to 255 of code page 437, which the Windows console prints, as Unicode
+static const unsigned short CODE_PAGE_437[128] = {
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
+};
 
 
 /*
-	@brief: initializes the values of the current profile's information and statistics to default
-        values, except for the creation date
-	
-	@param: CurrentProfile - pointer to the current profile's struct that we want to initialize
-	@param: name - the profile's name
+	@brief: writes bytes to the terminal with a single write where it can. Once the console is
+        initialized, the code page 437 characters are converted into UTF-8 on the way.
 
-    Precondition: The profile is being created or reset. MAX_ROWS and MAX_COLUMNS are accurate.
-*/
-void initializeProfile(struct Profile *CurrentProfile, char name[]) {
-    int i, j;
-    struct Game *CurrentGame = &CurrentProfile->CurrentGame;
+	@param: cookie - unused; present so that the function can serve as stdout's writer
+	@param: bytes - the bytes to write
+	@param: length - number of bytes
 
-    strcpy(CurrentProfile->name, name);
-    CurrentProfile->lifetimeGames = 0;
+	@return: length - the bytes were written
+             -1 - the terminal could not be written to
+*/
+ssize_t writeTerminal(void *cookie, const char *bytes, size_t length) {
+    static char *translated = NULL; // reused between writes; a character takes at most 3 bytes
+    static size_t capacity = 0;
+    const char *output = bytes;
+    size_t outputLength = length;
+    size_t newCapacity, i;
+    ssize_t numWritten;
+    unsigned short code;
+    char *newBytes;
+
+    (void) cookie;
+
+    if (isTranslating && length > 0) {
+        if (capacity < 3 * length) {
+            newCapacity = capacity == 0 ? 64 : capacity;
+            while (newCapacity < 3 * length) newCapacity *= 2;
+
+            newBytes = realloc(translated, newCapacity);
+            if (newBytes == NULL) return -1;
+
+            translated = newBytes;
+            capacity = newCapacity;
+        }
 
-    CurrentProfile->EasyStats.totalSeconds = 0;
-    CurrentProfile->EasyStats.won = 0;
-    CurrentProfile->EasyStats.lost = 0;
+        outputLength = 0;
+        for (i = 0; i < length; i++) {
+            if ((unsigned char) bytes[i] < 128) {
+                translated[outputLength++] = bytes[i];
+                continue;
+            }
 
-    CurrentProfile->DifficultStats.totalSeconds = 0;
-    CurrentProfile->DifficultStats.won = 0;
-    CurrentProfile->DifficultStats.lost = 0;
+            code = CODE_PAGE_437[(unsigned char) bytes[i] - 128];
+            if (code < 0x800) {
+                translated[outputLength++] = 0xC0 | code >> 6;
+            }
+            else {
+                translated[outputLength++] = 0xE0 | code >> 12;
+                translated[outputLength++] = 0x80 | (code >> 6 & 0x3F);
+            }
+            translated[outputLength++] = 0x80 | (code & 0x3F);
+        }
+        output = translated;
+    }
 
-    CurrentProfile->CustomStats.totalSeconds = 0;
-    CurrentProfile->CustomStats.won = 0;
-    CurrentProfile->CustomStats.lost = 0;
+    while (outputLength > 0) { // a terminal may take a long write in parts
+        numWritten = write(STDOUT_FILENO, output, outputLength);
+        if (numWritten < 0) return -1;
 
-    CurrentGame->exists = 0;
-    CurrentGame->rows = 0;
-    CurrentGame->columns = 0;
-    for (i = 0; i < MAX_ROWS; i++) {
-        for (j = 0; j < MAX_COLUMNS; j++) {
-            CurrentGame->Board[i][j].state = 0;
-            CurrentGame->Board[i][j].isFlagged = 0;
-            CurrentGame->Board[i][j].isRevealed = 0;
-        }
+        output += numWritten;
+        outputLength -= numWritten;
     }
-    strcpy(CurrentGame->mode, "");
-    strcpy(CurrentGame->outcome, "");
-    CurrentGame->seconds = 0;
 
-    CurrentProfile->RecentGame1.exists = 0;
-    CurrentProfile->RecentGame2.exists = 0;
-    CurrentProfile->RecentGame3.exists = 0;
+    return length;
+}
 
-    updateProfile(CurrentProfile);
+
+/*
+	@brief: puts the terminal's input back to whole lines if it was left reading single keys, so
+        the shell does not inherit a terminal that neither echoes nor edits lines
+*/
+void restoreLineInput() {
+    if (isRawInput) tcsetattr(STDIN_FILENO, TCSANOW, &LineInput);
+    isRawInput = 0;
 }
 
 
 /*
-    @brief: initializes the values of the current leaderboard's statistics to default values
+	@brief: puts the terminal's input back to whole lines, then lets the signal stop the program
+        as it would have
 
-    @param: CurrentLeaderboard - pointer to the leaderboard struct containing information regarding
-        the top records for each game mode
-    		
-    Precondition: MAX_RECORDS is accurate.
+	@param: signalNumber - the signal received
 */
-void initializeLeaderboard(struct Leaderboard *CurrentLeaderboard) {
-    int i;
+void stopOnSignal(int signalNumber) {
+    restoreLineInput();
+    signal(signalNumber, SIG_DFL);
+    raise(signalNumber);
+}
 
-    struct Records *EasyRecords = &CurrentLeaderboard->EasyRecords;
-    struct Records *DifficultRecords = &CurrentLeaderboard->DifficultRecords;
-    struct Records *CustomRecords = &CurrentLeaderboard->CustomRecords;
 
-    EasyRecords->numRecords = 0;
-    DifficultRecords->numRecords = 0;
-    CustomRecords->numRecords = 0;
+/*
+	@brief: switches the terminal's input between whole lines and single keys. Single keys are
+        read as they are pressed, without being echoed, and Enter is read as a carriage return
+        as it is on the Windows console. The first switch also makes sure the lines come back
+        when the program exits or is interrupted.
 
-    for (i = 0; i < MAX_RECORDS; i++) {
-        strcpy(EasyRecords->names[i], "");
-        EasyRecords->times[i] = 0;
+	@param: isRaw - 1 to read single keys, 0 to go back to the settings from before
 
-        strcpy(DifficultRecords->names[i], "");
-        DifficultRecords->times[i] = 0;
+	@return: 1 - the input was switched, or was already as asked
+             0 - the input is not a terminal
+*/
+int setRawInput(int isRaw) {
+    static int isRestoredOnExit = 0;
+    struct termios Keys;
+
+    if (isRaw == isRawInput) return 1;
+    if (!isRaw) {
+        restoreLineInput();
+        return 1;
+    }
 
-        strcpy(CustomRecords->names[i], "");
-        CustomRecords->times[i] = 0;
+    if (tcgetattr(STDIN_FILENO, &LineInput) != 0) return 0;
+
+    if (!isRestoredOnExit) {
+        atexit(restoreLineInput);
+        signal(SIGINT, stopOnSignal);
+        signal(SIGTERM, stopOnSignal);
+        isRestoredOnExit = 1;
     }
+
+    Keys = LineInput;
+    Keys.c_lflag &= ~(ICANON | ECHO);
+    Keys.c_iflag &= ~ICRNL;
+    Keys.c_cc[VMIN] = 1;
+    Keys.c_cc[VTIME] = 0;
+
+    isRawInput = tcsetattr(STDIN_FILENO, TCSANOW, &Keys) == 0;
+    return isRawInput;
 }
 
 
 /*
-	@brief: extracts information from leaderboard.txt and stores it into leaderboard struct
-	
-	@param: CurrentLeaderboard - pointer to the current leaderboard struct that we want to store
-        information into
-    
-    Precondition: The leaderboard text file is formatted correctly. LEADERBOARD_DIRECTORY is
-        accurate.
-*/
-void loadLeaderboard(struct Leaderboard *CurrentLeaderboard) {
-    FILE *fp;
-    int i;
+	@brief: decodes the rest of an escape sequence into the codes the Windows console gives the
+        same key, where an arrow key or Delete is read as ARROW_VALUE followed by a second code
 
-    fp = fopen(LEADERBOARD_DIRECTORY, "r");
-    if (fp == NULL) {
-        fp = fopen(LEADERBOARD_DIRECTORY, "w");
-        fprintf(fp, "0\n\n0\n\n0\n");
-        fclose(fp);
+	@param: pendingKey - pointer to where the second code is kept for the next read
 
-        loadLeaderboard(CurrentLeaderboard);
-        return;
-    }
+	@return: the first code of the key; ESCAPE_VALUE if Escape was pressed alone, or 0 if the
+             sequence is not of a key the program uses
 
-    // easy leaderboard
-    fscanf(fp, "%d", &CurrentLeaderboard->EasyRecords.numRecords);
-    for (i = 0; i < CurrentLeaderboard->EasyRecords.numRecords; i++) {
-        fscanf(fp, "%s", CurrentLeaderboard->EasyRecords.names[i]);
-        fscanf(fp, "%d", &CurrentLeaderboard->EasyRecords.times[i]);
-    }
+	Precondition: the terminal reads single keys, and the escape character was just read.
+*/
+int decodeEscapeSequence(int *pendingKey) {
+    struct pollfd Input = {STDIN_FILENO, POLLIN, 0};
+    char sequence[8];
+    int length = 0;
+    char byte;
 
-    // difficult leaderboard
-    fscanf(fp, "%d", &CurrentLeaderboard->DifficultRecords.numRecords);
-    for (i = 0; i < CurrentLeaderboard->DifficultRecords.numRecords; i++) {
-        fscanf(fp, "%s", CurrentLeaderboard->DifficultRecords.names[i]);
-        fscanf(fp, "%d", &CurrentLeaderboard->DifficultRecords.times[i]);
-    }
-    
-    // custom leaderboard
-    fscanf(fp, "%d", &CurrentLeaderboard->CustomRecords.numRecords);
-    for (i = 0; i < CurrentLeaderboard->CustomRecords.numRecords; i++) {
-        fscanf(fp, "%s", CurrentLeaderboard->CustomRecords.names[i]);
-        fscanf(fp, "%d", &CurrentLeaderboard->CustomRecords.times[i]);
-    }
+    // the rest of a sequence arrives right after the escape; Escape pressed alone has no rest
+    if (poll(&Input, 1, ESCAPE_TIMEOUT) <= 0) return ESCAPE_VALUE;
+    if (read(STDIN_FILENO, &byte, 1) != 1 || (byte != '[' && byte != 'O')) return 0;
 
-    fclose(fp);
+    // parameters come first, then a final byte from @ to ~
+    do {
+        if (length == sizeof(sequence) - 1 || read(STDIN_FILENO, &byte, 1) != 1) return 0;
+        sequence[length++] = byte;
+    } while (byte < '@' || byte > '~');
+    sequence[length] = '\0';
+
+    if (strcmp(sequence, "A") == 0) *pendingKey = UP_VALUE;
+    else if (strcmp(sequence, "B") == 0) *pendingKey = DOWN_VALUE;
+    else if (strcmp(sequence, "C") == 0) *pendingKey = RIGHT_VALUE;
+    else if (strcmp(sequence, "D") == 0) *pendingKey = LEFT_VALUE;
+    else if (strcmp(sequence, "3~") == 0) *pendingKey = DELETE_VALUE;
+    else return 0;
+
+    return ARROW_VALUE;
 }
+#endif
 
 
 /*
-    @brief: clears the input buffer after a user response
+	@brief: prepares the console for the screens. The Windows console is made to process escape
+        sequences; on other terminals, stdout is made to convert the code page 437 characters
+        of the screens into UTF-8.
 */
-void clearInputBuffer() {
-    char c;
-    do {
-        c = getchar();
-    } while (c != '\n' && c != EOF);
+void initializeConsole() {
+#ifdef _WIN32
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode;
+
+    if (GetConsoleMode(output, &mode)) SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+#else
+    cookie_io_functions_t Functions = {NULL, writeTerminal, NULL, NULL};
+    FILE *translated = fopencookie(NULL, "w", Functions);
+
+    if (translated == NULL) return;
+
+    fflush(stdout);
+    setvbuf(translated, NULL, _IOLBF, BUFSIZ); // flushed at each line, as a terminal's stdout is
+    stdout = translated;
+    isTranslating = 1;
+#endif
 }
 
 
 /*
-	@brief: sorts the profile names in alphabetical order using the selection sort algorithm
-	
-	@param: ProfileNames - array containing the list of existing profiles
-	@param: n - indicates how many profiles are in the array
+	@brief: writes bytes to the console with a single write, bypassing stdout's buffer
+
+	@param: bytes - the bytes to write
+	@param: length - number of bytes
 */
-void sortProfileNames(string20 ProfileNames[], int n) {
-    int i, j;
-    int index;
-    string20 temp;
+void writeConsole(const char *bytes, int length) {
+#ifdef _WIN32
+    _write(_fileno(stdout), bytes, length);
+#else
+    writeTerminal(NULL, bytes, length);
+#endif
+}
 
-    for (i = 0; i < n - 1; i++) {
-        index = i;
 
-        for (j = i + 1; j < n; j++) {
-            if (strcmp(ProfileNames[j], ProfileNames[index]) < 0) {
-                index = j;
-            }
-        }
+/*
+    @brief: starts a batch session: the menus are answered from a script rather than the console,
+        the screens are discarded, and the results are written to the original output instead
 
-        if (i != index) {
-            strcpy(temp, ProfileNames[i]);
-            strcpy(ProfileNames[i], ProfileNames[index]);
-            strcpy(ProfileNames[index], temp);
-        }
-    }
+    @param: script - path of the script, or "-" to read it from the standard input
+
+    @return: 1 - the session started
+             0 - the script or the output could not be opened
+*/
+int startBatch(char script[]) {
+    int output;
+
+    if (strcmp(script, "-") != 0 && freopen(script, "r", stdin) == NULL) return 0;
+
+    fflush(stdout);
+#ifdef _WIN32
+    output = _dup(_fileno(stdout));
+    resultsFile = output >= 0 ? _fdopen(output, "w") : NULL;
+#else
+    output = dup(STDOUT_FILENO);
+    resultsFile = output >= 0 ? fdopen(output, "w") : NULL;
+#endif
+    if (resultsFile == NULL || freopen(NULL_DEVICE, "w", stdout) == NULL) return 0;
+
+    isBatch = 1;
+    isPacing = 0; // nobody reads the screens
+    Batch.startMicroseconds = getMicroseconds();
+    Batch.numInputs = 0;
+    Batch.numGames = 0;
+    Batch.numWon = 0;
+    Batch.numLost = 0;
+    Batch.numQuit = 0;
+
+    return 1;
 }
 
 
 /*
-	@brief: stores the profiles in profiles directory into the ProfileNames[] array
-	
-	@param: ProfileNames - array of strings containing the existing profile names
-	
-    Precondition: PROFILES_DIRECTORY is accurate.
+    @brief: writes a line of results of a batch session, as an event name followed by key=value
+        fields; does nothing outside of batch sessions
 
-	@return: the number of profiles successfully read from the profiles text file
+    @param: format - printf format of the line, without its newline
 */
-int getProfileNames(string20 ProfileNames[]) {
-    FILE *fp;
-    string20 name;
-    int numProfiles = 0;
+void printResult(char format[], ...) {
+    va_list Arguments;
 
-    fp = fopen(PROFILES_DIRECTORY, "r");
+    if (!isBatch) return;
 
-    if (fp == NULL) {
-        fp = fopen(PROFILES_DIRECTORY, "w");
-        fclose(fp);
-        return getProfileNames(ProfileNames);
-    }
+    va_start(Arguments, format);
+    vfprintf(resultsFile, format, Arguments);
+    va_end(Arguments);
 
-    while (fscanf(fp, "%s", name) == 1) {
-        if (strcmp(name, "") != 0) {
-            strcpy(ProfileNames[numProfiles++], name);
-        }
-    }
+    fputc('\n', resultsFile);
+}
 
-    sortProfileNames(ProfileNames, numProfiles);
 
-    fclose(fp);
-    return numProfiles;
+/*
+    @brief: counts a finished game in the summary of a batch session
+
+    @param: outcome - WON_OUTCOME, LOST_OUTCOME, or QUIT_OUTCOME
+*/
+void countBatchGame(char outcome[]) {
+    Batch.numGames++;
+
+    if (strcmp(outcome, WON_OUTCOME) == 0) Batch.numWon++;
+    else if (strcmp(outcome, LOST_OUTCOME) == 0) Batch.numLost++;
+    else Batch.numQuit++;
 }
 
 
 /*
-    @brief: prints a divider consisting of several dashes to aid in display formatting
+    @brief: ends a batch session with a line summarizing it, then exits the program
+
+    @param: reason - "quit" if the script quit from the main menu; "eof" if the script ended first
 */
-void printDivider() {
-    printf(" \x1b[1m\x1b[37m----------------------------------------------------------------------------\x1b[0m");
+void endBatch(char reason[]) {
+    printResult("session ended=%s inputs=%d games=%d won=%d lost=%d quit=%d milliseconds=%lld",
+        reason, Batch.numInputs, Batch.numGames, Batch.numWon, Batch.numLost, Batch.numQuit,
+        (getMicroseconds() - Batch.startMicroseconds) / 1000);
+
+    fflush(resultsFile);
+    exit(0);
 }
 
 
 /*
-	@brief: prints a list of existing profiles
-	
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @brief: reads a key press of a batch session from the next line of its script. A line is a key
+        name (up, down, left, right, delete, enter, or esc) or the character typed; an empty line
+        is Enter, and a name that is not a key is a key that does nothing. The session ends with
+        the script.
+
+    @param: pendingKey - pointer to where the second code of an arrow or delete key is stored
+
+    @return: the code of the key
 */
-void printProfiles(int theme) {
-    int i;
-    string20 profileNames[MAX_PROFILES];
-    int numProfiles = getProfileNames(profileNames);
-	
-	printEvade(theme);
+int readScriptKey(int *pendingKey) {
+    char line[SCRIPT_LINE_SIZE];
+    int c;
 
-    printf("\n Here are the existing profiles:\n\n");
-    for (i = 0; i < numProfiles; i++) {
-        printf(" %d.) %s\n", i + 1, profileNames[i]);
+    if (fgets(line, SCRIPT_LINE_SIZE, stdin) == NULL) endBatch("eof");
+    Batch.numInputs++;
+
+    if (strchr(line, '\n') == NULL) { // the rest of a line too long for a key name is dropped
+        do {
+            c = getchar();
+        } while (c != '\n' && c != EOF);
     }
+    line[strcspn(line, "\r\n")] = '\0';
+
+    if (strcmp(line, "up") == 0) *pendingKey = UP_VALUE;
+    else if (strcmp(line, "down") == 0) *pendingKey = DOWN_VALUE;
+    else if (strcmp(line, "left") == 0) *pendingKey = LEFT_VALUE;
+    else if (strcmp(line, "right") == 0) *pendingKey = RIGHT_VALUE;
+    else if (strcmp(line, "delete") == 0) *pendingKey = DELETE_VALUE;
+    else if (strcmp(line, "enter") == 0 || strlen(line) == 0) return ENTER_VALUE;
+    else if (strcmp(line, "esc") == 0) return ESCAPE_VALUE;
+    else if (strlen(line) == 1) return (unsigned char) line[0];
+    else return 0;
+
+    return ARROW_VALUE;
 }
 
 
 /*
-	@brief: capitalizes all the letters of a string
-	
-	@param: string - the string to be capitalized
-
-    Precondition: The string only consists of letters from the English alphabet.
+	@brief: clears the console screen and its scrollback
 */
-void toUpperCaseString(string20 string) {
-    for (int i = 0; i < strlen(string); i++) {
-        string[i] = toupper(string[i]);
-    }
+void clearScreen() {
+    if (isBatch) return;
+
+#ifdef _WIN32
+    system("cls");
+#else
+    printf(CLEAR_SEQUENCE);
+    fflush(stdout);
+#endif
 }
 
 
-/*	
-	@brief: checks if a particular profile exists
-	
-	@param: name - the name being checked
-	
-	@return: 1 - profile exists
-			 0 - profile does not exist
-	
+/*
+	@brief: gets the size of the console's window
+
+	@param: rows - pointer to where the number of lines is stored
+	@param: columns - pointer to where the number of characters per line is stored
+
+	@return: 1 - the size was stored
+             0 - the output is not a console, so it has no size
 */
-int profileExists(string20 name) {
-    int i;
-    string20 ProfileNames[10];
-    int numProfiles = getProfileNames(ProfileNames);
+int getConsoleSize(int *rows, int *columns) {
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO Info;
 
-    toUpperCaseString(name);
+    if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &Info)) return 0;
 
-    for (i = 0; i < numProfiles; i++) {
-        if (strcmp(name, ProfileNames[i]) == 0) {
-            return 1;
-        }
-    }
+    *rows = Info.srWindow.Bottom - Info.srWindow.Top + 1;
+    *columns = Info.srWindow.Right - Info.srWindow.Left + 1;
+#else
+    struct winsize Size;
 
-    return 0;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &Size) != 0 || Size.ws_row == 0 || Size.ws_col == 0) return 0;
+
+    *rows = Size.ws_row;
+    *columns = Size.ws_col;
+#endif
+
+    return 1;
 }
 
 
 /*
-	@brief: extracts information from the current profile's text file and stores it into the current
-        profile structure
-	
-	@param: CurrentProfile - pointer to the structure holding the current profile information
-	@param: name - name of the profile
-	
-	Precondition: The profile text file being loaded stores the profile information in a correct,
-        accurate format.
-	
+	@brief: reads a single key press without waiting for Enter or echoing it. Keys beyond the
+        ASCII characters are read as two codes, as getch reads them on the Windows console.
+
+	@return: the code of the key, or EOF if the input has ended
 */
-void loadProfile(struct Profile *CurrentProfile, string20 name) {
-    FILE *fp;
-    int i, j;
-    int code;
+int readKey() {
+    static int pendingKey = 0; // second code of the last key, returned by the next read
+    int key;
+
+    if (pendingKey != 0) {
+        key = pendingKey;
+        pendingKey = 0;
+        return key;
+    }
 
-    struct Game *RecentGame1 = &CurrentProfile->RecentGame1;
-    struct Game *RecentGame2 = &CurrentProfile->RecentGame2;
-    struct Game *RecentGame3 = &CurrentProfile->RecentGame3;
-
-    string100 directory = "profiles\\";
-    strcat(directory, name);
-    strcat(directory, ".txt");
+    if (isBatch) return readScriptKey(&pendingKey);
 
-    fp = fopen(directory, "r");
-    if (fp == NULL) {
-        CurrentProfile->creationDate = getDateCode();
-        initializeProfile(CurrentProfile, name);
-        loadProfile(CurrentProfile, name);
-        return;
-    }
+#ifdef _WIN32
+    return getch();
+#else
+    int isRaw;
+    char byte;
 
-    // current profile information
-    fscanf(fp, "%s", CurrentProfile->name);
-    fscanf(fp, "%d", &CurrentProfile->creationDate);
-    fscanf(fp, "%d", &CurrentProfile->lifetimeGames);
+    fflush(stdout);
+    if (!isatty(STDIN_FILENO)) return getchar(); // piped input has no keys to decode
 
-    // easy statistics
-    fscanf(fp, "%d", &CurrentProfile->EasyStats.totalSeconds);
-    fscanf(fp, "%d", &CurrentProfile->EasyStats.won);
-    fscanf(fp, "%d", &CurrentProfile->EasyStats.lost);
+    isRaw = !isRawInput && setRawInput(1); // switched only for this key, unless a screen holds it
 
-    // difficult statistics
-    fscanf(fp, "%d", &CurrentProfile->DifficultStats.totalSeconds);
-    fscanf(fp, "%d", &CurrentProfile->DifficultStats.won);
-    fscanf(fp, "%d", &CurrentProfile->DifficultStats.lost);
+    key = read(STDIN_FILENO, &byte, 1) == 1 ? (unsigned char) byte : EOF;
+    if (key == ESCAPE_VALUE) key = decodeEscapeSequence(&pendingKey);
 
-    // custom statistics
-    fscanf(fp, "%d", &CurrentProfile->CustomStats.totalSeconds);
-    fscanf(fp, "%d", &CurrentProfile->CustomStats.won);
-    fscanf(fp, "%d", &CurrentProfile->CustomStats.lost);
+    if (isRaw) setRawInput(0);
+    return key;
+#endif
+}
 
-    // recent game 1
-    fscanf(fp, "%d", &RecentGame1->exists);
-    if (RecentGame1->exists) { 
-        fscanf(fp, "%d", &RecentGame1->rows);
-        fscanf(fp, "%d", &RecentGame1->columns);
 
-        // recent game 1 board
-        for (i = 0; i < RecentGame1->rows; i++) {
-            for (j = 0; j < RecentGame1->columns; j++) {
-                fscanf(fp, "%d", &code);
-                RecentGame1->Board[i][j].state = code / 100;
-                RecentGame1->Board[i][j].isFlagged = code / 10 % 10;
-                RecentGame1->Board[i][j].isRevealed = code % 10;
-            }
-        }
+/*
+	@brief: checks if a key is waiting to be read, without waiting for one
 
-        fscanf(fp, "%s", RecentGame1->mode);
-        fscanf(fp, "%s", RecentGame1->outcome);
-        fscanf(fp, "%d", &RecentGame1->seconds);
-    }
+	@return: 1 - a key is waiting
+             0 - no key is waiting
+*/
+int isKeyWaiting() {
+#ifdef _WIN32
+    return _kbhit();
+#else
+    struct pollfd Input = {STDIN_FILENO, POLLIN, 0};
+
+    return poll(&Input, 1, 0) > 0;
+#endif
+}
 
-    // recent game 2
-    fscanf(fp, "%d", &RecentGame2->exists);
-    if (RecentGame2->exists) { 
-        fscanf(fp, "%d", &RecentGame2->rows);
-        fscanf(fp, "%d", &RecentGame2->columns);
 
-        // recent game 2 board
-        for (i = 0; i < RecentGame2->rows; i++) {
-            for (j = 0; j < RecentGame2->columns; j++) {
-                fscanf(fp, "%d", &code);
-                RecentGame2->Board[i][j].state = code / 100;
-                RecentGame2->Board[i][j].isFlagged = code / 10 % 10;
-                RecentGame2->Board[i][j].isRevealed = code % 10;
-            }
-        }
+/*
+	@brief: waits until the console has input or a time passes, whichever comes first
 
-        fscanf(fp, "%s", RecentGame2->mode);
-        fscanf(fp, "%s", RecentGame2->outcome);
-        fscanf(fp, "%d", &RecentGame2->seconds);
-    }
+	@param: milliseconds - longest time to wait
+*/
+void waitForInput(int milliseconds) {
+#ifdef _WIN32
+    WaitForSingleObject(GetStdHandle(STD_INPUT_HANDLE), milliseconds);
+#else
+    struct pollfd Input = {STDIN_FILENO, POLLIN, 0};
+    int isRaw = !isRawInput && setRawInput(1); // so that any key ends the wait, not only Enter
+
+    poll(&Input, 1, milliseconds);
+    if (isRaw) setRawInput(0);
+#endif
+}
 
-    // recent game 3
-    fscanf(fp, "%d", &RecentGame3->exists);
-    if (RecentGame3->exists) { 
-        fscanf(fp, "%d", &RecentGame3->rows);
-        fscanf(fp, "%d", &RecentGame3->columns);
 
-        // recent game 3 board
-        for (i = 0; i < RecentGame3->rows; i++) {
-            for (j = 0; j < RecentGame3->columns; j++) {
-                fscanf(fp, "%d", &code);
-                RecentGame3->Board[i][j].state = code / 100;
-                RecentGame3->Board[i][j].isFlagged = code / 10 % 10;
-                RecentGame3->Board[i][j].isRevealed = code % 10;
-            }
-        }
+/*
+	@brief: keeps the console reading single keys between reads, for the board screens that read
+        one key after another. Otherwise every key switches the terminal to single keys and
+        back, and keys pressed while a frame is drawn are echoed onto it. The hold must be
+        let go before a line is read. The Windows console never echoes getch, so there it
+        does nothing.
 
-        fscanf(fp, "%s", RecentGame3->mode);
-        fscanf(fp, "%s", RecentGame3->outcome);
-        fscanf(fp, "%d", &RecentGame3->seconds);
-    }
+	@param: isHeld - 1 to hold the console on single keys, 0 to go back to lines
+*/
+void holdRawInput(int isHeld) {
+#ifdef _WIN32
+    (void) isHeld;
+#else
+    if (!isBatch && isatty(STDIN_FILENO)) setRawInput(isHeld);
+#endif
 }
 
 
 /*
-    @brief: prompts the user to press enter to return to the main menu
+	@brief: forces the data written to a file to disk, so it survives the program or the computer
+        stopping
+
+	@param: fp - the file, already flushed
 */
-void pressEnter() {
-    printf(" Press 'Enter' to return to the Main Menu.");
-    clearInputBuffer();
+void syncFile(FILE *fp) {
+#ifdef _WIN32
+    _commit(_fileno(fp));
+#else
+    fsync(fileno(fp));
+#endif
 }
 
 
 /*
-	@brief: prompts the user to select an existing profile from the profile directory
-	
-	@param: CurrentProfile - pointer to the structure holding the current profile information
-    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+	@brief: pauses so that a message can be read or an animation can play. The pause waits on the
+        console's input rather than sleeping, so it ends as soon as a key is pressed, and the key
+        is left for whatever reads input next; typing ahead skips every pause.
 
-    Precondition: The list of profiles is accurate.
+	@param: milliseconds - longest time to pause
 */
-void selectProfile(struct Profile *CurrentProfile, int theme) {
-    string20 profile;
-    int exists;
+void pace(int milliseconds) {
+    long long endTime = getMicroseconds() + milliseconds * 1000LL;
+    long long remaining;
 
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
+    if (!isPacing) return;
+    fflush(stdout);
 
-        printf("\n");
-        printDivider();
-        printf("\n");
+    while (!isKeyWaiting()) {
+        remaining = (endTime - getMicroseconds()) / 1000;
+        if (remaining <= 0) return;
 
-        printProfiles(theme);
+        waitForInput(remaining); // wakes at the first input event
+    }
+}
 
-        printf("\n");
-        printDivider();
 
-        printf("\n\n Enter an existing profile to load (or '0' to return to the main menu): ");
-        scanf("%s", profile);
-        clearInputBuffer();
+/*
+    @brief: gets the value of a single bit in a bitplane
 
-        if (strcmp(profile, "0") == 0) {
-            return;
-        }
+    @param: plane - array of words storing one bit per tile
+    @param: index - flat index of the tile
 
-        exists = profileExists(profile);
-        if (!exists) {
-            printf("\n The profile '%s' does not exist.", profile);
-        }
-        
-    } while (!exists);
+    @return: 1 - bit is set
+             0 - bit is not set
+*/
+int getBit(bitword plane[], int index) {
+    return (plane[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
 
-    // account change processing
-    remove("profiles\\GUEST.txt");
 
-    Sleep(SHORT_SLEEP);
-    printf("\n Successful.");
-    Sleep(SHORT_SLEEP);
+/*
+    @brief: sets or clears a single bit in a bitplane
 
-    printf(" The current profile has been changed from '%s' to '%s'.", CurrentProfile->name, profile);
-    loadProfile(CurrentProfile, profile); // load the selected profile's information
-    Sleep(LONG_SLEEP);
-    
-    printf("\n\n");
-    pressEnter();
+    @param: plane - array of words storing one bit per tile
+    @param: index - flat index of the tile
+    @param: value - 1 to set the bit, 0 to clear it
+*/
+void setBit(bitword plane[], int index, int value) {
+    bitword mask = (bitword) 1 << (index % WORD_BITS);
+
+    if (value) {
+        plane[index / WORD_BITS] |= mask;
+    }
+    else {
+        plane[index / WORD_BITS] &= ~mask;
+    }
 }
 
 
 /*
-    @brief: checks if a profile name is valid
-	
-	@param: name - name of the profile being created
-	
-	@return: 1 - valid profile name
-			 0 - invalid profile name
-*/
-int isValidProfileName(string20 name) {
-    int i;
-    int strLen = strlen(name);
-    int hasGoodLength, isAlphabetic, isNotTaken, isNotReserved;
+    @brief: gets the number of words used by each bitplane of a board
 
-    toUpperCaseString(name);
+    @param: Board - pointer to the board
 
-    // the name has between 3 to 20 characters
-    hasGoodLength = strLen >= 3 && strLen <= 20;
+    @return: number of words covering all of the board's tiles
+*/
+int getNumWords(struct Board *Board) {
+    return (Board->rows * Board->columns + WORD_BITS - 1) / WORD_BITS;
+}
 
-    // the name only contains letters of the English alphabet
-    isAlphabetic = 1;
-    for (i = 0; i < strLen; i++) {
-        if (!isalpha(name[i])) {
-            isAlphabetic = 0;
-        }
-    }
 
-    // the name has not yet been taken
-    isNotTaken = !profileExists(name);
+/*
+    @brief: converts a row and column into the flat index used by the bitplanes
 
-    // the name has not yet been reserved for the program
-    isNotReserved = strcmp(name, "GUEST") != 0;
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
 
-    // inform the user of the naming requirements
-    if (!hasGoodLength) {
-        printf("\tThe name must contain between 3 to 20 characters!\n");
-        Sleep(SHORT_SLEEP);
-    }
-    if (!isAlphabetic) {
-        printf("\tThe name must only contain letters from the English alphabet!\n");
-        Sleep(SHORT_SLEEP);
-    }
-    if (!isNotTaken) {
-        printf("\tThe name '%s' has already been taken. Please provide another name!\n", name);
-        Sleep(SHORT_SLEEP);
-    }
-    if (!isNotReserved) {
-        printf("\tThe name '%s' has already been reserved for the program. Please provide another name!\n", name);
-        Sleep(SHORT_SLEEP);
-    }
+    @return: the flat index of the tile
 
-    return hasGoodLength && isAlphabetic && isNotTaken && isNotReserved;
+    Precondition: assumes row and column are not out of bounds
+*/
+int getTileIndex(struct Board *Board, int row, int column) {
+    return row * Board->columns + column;
 }
 
 
 /*
-    @brief: guides the user in creating a new profile, then creates the corresponding text file and
-        updates the list of profiles
-	
-	@param: CurrentProfile - pointer to the current profile struct holding the current profile's
-        information
-	
-	@return: 1 - successfully created a profile
-			 0 - a profile was not created
+    @brief: checks if a tile is a mine
 
-    Precondition: MAX_PROFILES is accurate.
-*/
-int createProfile(struct Profile *CurrentProfile, int theme) {
-    FILE *fp;
-    string20 name;
-    string20 ProfileNames[10];
+    @param: Board - pointer to the board
+    @param: index - flat index of the tile
 
-    Sleep(SHORT_SLEEP);
+    @return: 1 - tile is a mine
+             0 - tile is not a mine
+*/
+int hasMine(struct Board *Board, int index) {
+    return getBit(Board->Mines.plane, index);
+}
 
-    // restrict the user from creating a profile if there are at least 10 existing ones
-    if (getProfileNames(ProfileNames) >= MAX_PROFILES) {
-        printf("\n Sorry, you cannot create a new profile as there can only be a maximum of ");
-        printf("%d profiles.", MAX_PROFILES);
-        Sleep(LONG_SLEEP);
 
-        printf("\n\n");
-        pressEnter();
-        return 0;
-    }
+/*
+    @brief: adds a tile to a mine index, growing the list of mines when it is full
 
-    system("cls");
+    @param: Mines - pointer to the mine index
+    @param: index - flat index of the tile
 
-    printf("\n");
-    printDivider();
-    printf("\n");
+    @return: 1 - mine was added
+             0 - not enough memory to grow the list (the index is left unchanged)
 
-    printProfiles(theme);
+    Precondition: the tile is not already a mine
+*/
+int addMine(struct MineIndex *Mines, int index) {
+    int newCapacity;
+    int *newCells;
 
-    printf("\n");
-    printDivider();
-    printf("\n\n");
+    if (Mines->numMines == Mines->cellCapacity) {
+        newCapacity = Mines->cellCapacity == 0 ? 64 : Mines->cellCapacity * 2;
+        newCells = realloc(Mines->cells, newCapacity * sizeof(int));
+        if (newCells == NULL) return 0;
 
-    printf(" Requirements:\n\n");
-    printf(" 1.) The name must contain between 3 to 20 characters.\n");
-    printf(" 2.) The name must only contain letters from the English alphabet.\n");
-    printf(" 3.) The name must not have already been taken by an existing profile.\n\n");
+        Mines->cells = newCells;
+        Mines->cellCapacity = newCapacity;
+    }
 
-    printDivider();
-    printf("\n");
+    Mines->cells[Mines->numMines++] = index;
+    setBit(Mines->plane, index, 1);
+    return 1;
+}
 
-    do {
-        printf("\n Enter a valid name for your profile (or '0' to return to the main menu): ");
-        scanf("%s", name);
-        clearInputBuffer();
 
-        if (strcmp(name, "0") == 0) return 0;
-    } while (!isValidProfileName(name));
-    
-    // initialize the account information, as well as their creation date
-    CurrentProfile->creationDate = getDateCode();
-    initializeProfile(CurrentProfile, name);
+/*
+    @brief: removes a tile from a mine index; the last mine in the list takes its place. Only the
+        level editor removes mines, so the linear search for the tile is not a concern.
 
-    fp = fopen(PROFILES_DIRECTORY, "a");
-    fprintf(fp, "%s\n", CurrentProfile->name);
-    fclose(fp);
+    @param: Mines - pointer to the mine index
+    @param: index - flat index of the tile
 
-    Sleep(SHORT_SLEEP);
-    printf("\n Successful.");
-    Sleep(SHORT_SLEEP);
+    Precondition: the tile is a mine
+*/
+void removeMine(struct MineIndex *Mines, int index) {
+    int i = 0;
 
-    printf(" The profile '%s' has been created.", name);
-    Sleep(LONG_SLEEP);
-    
-    printf("\n\n");
-    pressEnter();
+    while (Mines->cells[i] != index) i++;
 
-    return 1;
+    Mines->cells[i] = Mines->cells[--Mines->numMines];
+    setBit(Mines->plane, index, 0);
 }
 
 
 /*
-    @brief: prompts the user to confirm their action
-	
-	@return: 1 - user confirms
-			 0 - user does not confirm
+    @brief: prepares a board for first use; the board holds no buffers until it is cleared
+
+    @param: Board - pointer to the board being initialized
 */
-int confirmAction() {
-    char c;
+void initializeBoard(struct Board *Board) {
+    Board->rows = 0;
+    Board->columns = 0;
+    Board->capacity = 0;
+    Board->Mines.plane = NULL;
+    Board->Mines.cells = NULL;
+    Board->Mines.numMines = 0;
+    Board->Mines.cellCapacity = 0;
+    Board->revealedPlane = NULL;
+    Board->flaggedPlane = NULL;
+    Board->states = NULL;
+    Board->workStack = NULL;
+    Board->workCapacity = 0;
+    Board->rowBuffer = NULL;
+    Board->rowCapacity = 0;
+}
 
-    do {
-        printf("\n Yes [Y] or No [N]: ");
-        scanf("%c", &c);
-        clearInputBuffer();
-    } while (!(c == 'Y' || c == 'N'));
 
-    return c == 'Y';
+/*
+    @brief: releases the buffers of a board
+
+    @param: Board - pointer to the board being freed
+
+    Precondition: The board has been initialized with initializeBoard.
+*/
+void freeBoard(struct Board *Board) {
+    free(Board->Mines.plane);
+    free(Board->Mines.cells);
+    free(Board->revealedPlane);
+    free(Board->flaggedPlane);
+    free(Board->states);
+    free(Board->workStack);
+    free(Board->rowBuffer);
+    initializeBoard(Board);
 }
 
 
 /*
-    @brief: guides the user in deleting an existing profile; restricts them from deleting the
-        current profile
+    @brief: empties a board and sets its dimensions; no mines, flags, or revealed tiles remain.
+        The buffers are reused when they are large enough and reallocated otherwise.
 
-    @param: name - name of the current profile
-    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @param: Board - pointer to the board being cleared
+    @param: rows - the new number of rows
+    @param: columns - the new number of columns
 
-    Precondition: The list of profile is accurate. PROFILES_DIRECTORY is accurate.
+    @return: 1 - board is ready
+             0 - not enough memory for a board of this size (the board is left empty)
+
+    Precondition: The board has been initialized with initializeBoard.
 */
-void deleteProfile(string20 name, int theme) {
-    FILE *fp;
-    int i;
-    int exists, isCurrent;
-
-    string100 directory = "profiles\\";
-    string20 profile;
-    string20 ProfileNames[10];
-    int numProfiles = getProfileNames(ProfileNames);
-
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
+int clearBoard(struct Board *Board, int rows, int columns) {
+    int numTiles = rows * columns;
+    int numWords = (numTiles + WORD_BITS - 1) / WORD_BITS;
+
+    if (numTiles > Board->capacity) {
+        freeBoard(Board);
+
+        Board->Mines.plane = malloc(numWords * sizeof(bitword));
+        Board->revealedPlane = malloc(numWords * sizeof(bitword));
+        Board->flaggedPlane = malloc(numWords * sizeof(bitword));
+        Board->states = malloc(numTiles);
+
+        if (Board->Mines.plane == NULL || Board->revealedPlane == NULL || Board->flaggedPlane == NULL ||
+            Board->states == NULL) {
+            freeBoard(Board);
+            return 0;
+        }
 
-        printf("\n");
-        printDivider();
-        printf("\n");
+        Board->capacity = numTiles;
+    }
 
-        printProfiles(theme);
+    Board->rows = rows;
+    Board->columns = columns;
+    Board->Mines.numMines = 0;
+    Board->numHiddenSafe = numTiles;
+    Board->explodedTile = -1;
 
-        printf("\n");
-        printDivider();
+    memset(Board->Mines.plane, 0, numWords * sizeof(bitword));
+    memset(Board->revealedPlane, 0, numWords * sizeof(bitword));
+    memset(Board->flaggedPlane, 0, numWords * sizeof(bitword));
+    memset(Board->states, 0, numTiles);
 
-        printf("\n\n Enter an existing profile to delete (or '0' to return to the main menu): ");
-        scanf("%s", profile);
-        toUpperCaseString(profile);
-        clearInputBuffer();
-        
-        if (strcmp(profile, "0") == 0) return;
+    return 1;
+}
 
-        exists = profileExists(profile);
-        if (!exists) {
-            printf("\n The profile '%s' does not exist.", profile);
-        }
 
-        isCurrent = strcmp(profile, name) == 0;
-        if (isCurrent) {
-            printf("\n You cannot delete '%s' as it is the current profile!", profile);
-        }
-    } while (!exists || isCurrent);
-    
-    printf("\n Are you sure you want to delete the profile '%s'?\n", profile);
+/*
+    @brief: hides every tile and removes every flag while keeping the mines and tile states
 
-    if (!confirmAction()) return;
+    @param: Board - pointer to the board being reset
+*/
+void resetBoardProgress(struct Board *Board) {
+    int numWords = getNumWords(Board);
 
-    fp = fopen(PROFILES_DIRECTORY, "w");
+    memset(Board->revealedPlane, 0, numWords * sizeof(bitword));
+    memset(Board->flaggedPlane, 0, numWords * sizeof(bitword));
 
-    for (i = 0; i < numProfiles; i++) {
-        if (strcmp(ProfileNames[i], profile) != 0) {
-            fprintf(fp, "%s\n", ProfileNames[i]);
-        }
+    if (Board->explodedTile >= 0) {
+        Board->states[Board->explodedTile] = 9;
     }
 
-    fclose(fp);
-
-    strcat(directory, profile);
-    strcat(directory, ".txt");
-    remove(directory);
-
-    Sleep(SHORT_SLEEP);
-    printf("\n Successful.");
-    Sleep(SHORT_SLEEP);
-
-    printf(" The profile '%s' has been deleted.", profile);
-    Sleep(LONG_SLEEP);
-    
-    printf("\n\n");
-    pressEnter();
+    Board->numHiddenSafe = Board->rows * Board->columns - Board->Mines.numMines;
+    Board->explodedTile = -1;
 }
 
 
 /*
-    @brief: guides the user in selecting, creating, or deleting profiles
-	
-	@param: CurrentProfile - pointer to the current profile structure holding the current profile
-        information
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-	
-	Precondition: The list of profiles is accurate.
-*/
-void profileHandler(struct Profile *CurrentProfile, int theme) {
-    char userResponse;
-    string20 ProfileNames[10];
-    
-    getProfileNames(ProfileNames);
-
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
-
-        printf("\n");
-        printDivider();
-        printf("\n\n");
-		
-		printMenu(theme);
-		
-        printf("\n\n Current profile: %s\n\n", CurrentProfile->name);
-        printf(" [a] Select an Existing Profile\n [b] Create a New Profile\n [c] Delete an Existing Profile\n\n");
+    @brief: gets the state of a tile (0 - 8 nearby mines, 9 - mine, 10 - exploded mine)
 
-        printDivider();
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
 
-        printf("\n\n Please input the letter corresponding to your action (a/b/c): ");
-        scanf("%c", &userResponse);
-        clearInputBuffer();
-    } while (!(userResponse >= 'a' && userResponse <= 'c'));
+    @return: the state of the tile
 
-    if (userResponse == 'a') { // user wants to select an existing profile
-        selectProfile(CurrentProfile, theme);
-    }
-    else if (userResponse == 'b') { // user wants to create a new profile
-        if (createProfile(CurrentProfile, theme)) {
-            remove("profiles\\GUEST.txt");
-        }
-    }
-    else if (userResponse == 'c') { // user wants to delete an existing profile
-        deleteProfile(CurrentProfile->name, theme);
-        if (!profileExists(CurrentProfile->name)) {
-            initializeProfile(CurrentProfile, "GUEST");
-        }
-    }
+    Precondition: assumes row and column are not out of bounds
+*/
+int getTileState(struct Board *Board, int row, int column) {
+    return Board->states[getTileIndex(Board, row, column)];
 }
 
 
 /*
-    @brief: generates a pseudorandom integer between a range of numbers
+    @brief: checks if a tile is revealed
 
-    @param: min - minimum number in the range
-    @param: max - maximum number in the range
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
 
-    @return: pseudorandom-generated integer
+    @return: 1 - tile is revealed
+             0 - tile is not revealed
 
-    Precondition: assumes parameters are nonnegative and min is less than or equal to max
+    Precondition: assumes row and column are not out of bounds
 */
-int getRandInt(int min, int max) {
-    return min + rand() % (max - min + 1); // randomly generates an integer in the interval [min, max]
+int isTileRevealed(struct Board *Board, int row, int column) {
+    return getBit(Board->revealedPlane, getTileIndex(Board, row, column));
 }
 
 
 /*
-    @brief: generates a easy/difficult classic game
-	
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-    @param: mineLocations - array of integers representing mine locations
-	@param: rows - indicates the number of rows of the board (8 - easy, 10 - difficult)
-	@param: columns - indicates the number of columns of the board (8 - easy, 15 - difficult)
-	@param: numMines - indicates the number of mines (10 - easy, 35 - difficult)
-
-    Precondition: The user intended to select classic mode.
-*/
-void generateClassicGame(struct Tile Board[][15], int mineLocations[], int rows, int columns, int numMines) {
-    int i;
-    int mineCount = 0;
-    int isValid;
-    int randRow, randColumn;
-    int mineRow, mineColumn;
+    @brief: checks if a tile is flagged
 
-    // randomly generate the mines
-    while (mineCount < numMines) {
-        isValid = 1;
-        randRow = getRandInt(0, rows - 1);
-        randColumn = getRandInt(0, columns - 1);
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
 
-        for (i = 0; i < mineCount; i++) {
-            mineRow = mineLocations[i] / 100;
-            mineColumn = mineLocations[i] % 100;
-
-            if (randRow == mineRow && randColumn == mineColumn) {
-                isValid = 0;
-            }
-        }
+    @return: 1 - tile is flagged
+             0 - tile is not flagged
 
-        if (isValid) {
-            Board[randRow][randColumn].state = 9;
-            mineLocations[mineCount++] = randRow * 100 + randColumn;
-        }
-    }
+    Precondition: assumes row and column are not out of bounds
+*/
+int isTileFlagged(struct Board *Board, int row, int column) {
+    return getBit(Board->flaggedPlane, getTileIndex(Board, row, column));
 }
 
 
 /*
-    @brief: prints a list of the existing custom levels
-
-    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-*/
-void printLevels(int theme) {
-    FILE *fp;
-    int i;
-    int numLevels;
-    string20 level;
+    @brief: reveals or hides a single tile without inspecting it; revealing a mine this way does not
+        count as inspecting it (see revealTiles)
 
-    fp = fopen(LEVELS_DIRECTORY, "r");
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
+    @param: isRevealed - 1 to reveal the tile, 0 to hide it
 
-    if (fp == NULL) {
-        fp = fopen(LEVELS_DIRECTORY, "w");
-        fclose(fp);
+    Precondition: assumes row and column are not out of bounds
+*/
+void setTileRevealed(struct Board *Board, int row, int column, int isRevealed) {
+    int index = getTileIndex(Board, row, column);
 
-        printLevels(theme);
-        return;
+    if (getBit(Board->revealedPlane, index) != isRevealed && !hasMine(Board, index)) {
+        Board->numHiddenSafe += isRevealed ? -1 : 1;
     }
 
-    fscanf(fp, "%d", &numLevels);
+    setBit(Board->revealedPlane, index, isRevealed);
+}
 
-    printf("\n");
-	printEvade(theme);
 
-    printf("\n Here are the existing custom levels:\n\n");
-    for (i = 0; i < numLevels; i++) {
-        fscanf(fp, "%s", level);
-        printf(" %d.) %s\n", i + 1, level);
-    }
+/*
+    @brief: places or removes a flag on a single tile
 
-    fclose(fp);
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
+    @param: isFlagged - 1 to flag the tile, 0 to remove the flag
+
+    Precondition: assumes row and column are not out of bounds
+*/
+void setTileFlagged(struct Board *Board, int row, int column, int isFlagged) {
+    setBit(Board->flaggedPlane, getTileIndex(Board, row, column), isFlagged);
 }
 
 
 /*
-    @brief: guides the user in generating a custom game
-	
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-	@param: rows - pointer to the current profile's current game struct variable storing the current
-        game's rows
-	@param: columns - pointer to the current profile's current game struct variable storing the current
-        game's columns
-    @param: mineLocations - array of integers representing mine locations
-    @param: numMines - pointer to a variable storing the current game's number of mines
-    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-	
-	@return: 1 - successfully generated a custom game
-			 0 - unsuccessfully generated a custom game
-
-    Precondition: The list of levels is accurate.
-*/
-int generateCustomGame(struct Tile Board[][15], int *rows, int *columns, int mineLocations[], int *numMines, int theme) {
-    FILE *fp;
-    int i, j;
-    char c;
+    @brief: places a mine on a tile, or turns a mine back into a plain tile
 
-    string100 directory;
-    string100 name;
+    @param: Board - pointer to the board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
+    @param: isMine - 1 to place a mine, 0 to remove it
 
-    *numMines = 0;
+    @return: 1 - tile was updated
+             0 - not enough memory to record another mine (the tile is left unchanged)
 
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
+    Precondition: assumes row and column are not out of bounds. Adjacency counts are computed
+        afterwards by initializeTileStates.
+*/
+int setTileMine(struct Board *Board, int row, int column, int isMine) {
+    int index = getTileIndex(Board, row, column);
 
-        printf("\n");
-        printDivider();
+    if (hasMine(Board, index) != isMine) {
+        if (isMine) {
+            if (!addMine(&Board->Mines, index)) return 0;
+        }
+        else {
+            removeMine(&Board->Mines, index);
+        }
 
-        printLevels(theme);
+        if (!getBit(Board->revealedPlane, index)) {
+            Board->numHiddenSafe += isMine ? -1 : 1;
+        }
+    }
 
-        printf("\n");
-        printDivider();
-        printf("\n\n");
+    Board->states[index] = isMine ? 9 : 0;
+    return 1;
+}
 
-        printf(" Enter an existing level to load (or '0' to return to the main menu): ");
-        scanf("%s", name);
-        clearInputBuffer();
 
-        if (strcmp(name, "0") == 0) return 0;
+/*
+    @brief: makes a board a copy of another one: same dimensions, mines, tile states, revealed tiles,
+        and flags. The copy's buffers are reused when they are large enough.
 
-        strcpy(directory, "levels\\");
-        strcat(directory, name);
-        strcat(directory, ".txt");
+    @param: Destination - pointer to the board receiving the copy
+    @param: Source - pointer to the board being copied
 
-        fp = fopen(directory, "r");
-        if (fp == NULL) {
-            printf("\n The level '%s' does not exist!", name);
-        }
-    } while (fp == NULL);
+    @return: 1 - board was copied
+             0 - not enough memory (the destination is left empty)
 
-    fscanf(fp, "%d %d", rows, columns);
+    Precondition: Both boards have been initialized with initializeBoard.
+*/
+int copyBoard(struct Board *Destination, struct Board *Source) {
+    int i;
+    int numWords = getNumWords(Source);
 
-    for (i = 0; i < *rows; i++) {
-        for (j = 0; j < *columns; j++) {
-            fscanf(fp, "%c", &c);
+    if (!clearBoard(Destination, Source->rows, Source->columns)) return 0;
 
-            if (c == 'X') {
-                Board[i][j].state = 9;
-                mineLocations[(*numMines)++] = i * 100 + j;
-            }
-            else if (!(c == 'X' || c == '.')) { // some special character was encountered
-                j--;
-            }
+    for (i = 0; i < Source->Mines.numMines; i++) {
+        if (!addMine(&Destination->Mines, Source->Mines.cells[i])) {
+            clearBoard(Destination, Source->rows, Source->columns);
+            return 0;
         }
     }
 
-    Sleep(SHORT_SLEEP);
-    fclose(fp);
+    memcpy(Destination->revealedPlane, Source->revealedPlane, numWords * sizeof(bitword));
+    memcpy(Destination->flaggedPlane, Source->flaggedPlane, numWords * sizeof(bitword));
+    memcpy(Destination->states, Source->states, Source->rows * Source->columns);
+
+    Destination->numHiddenSafe = Source->numHiddenSafe;
+    Destination->explodedTile = Source->explodedTile;
     return 1;
 }
 
 
 /*
-    @brief: increments a tile's state if it is within bounds and is not a mine
+	@brief: updates the current profile struct's statistics based on the current game outcome
 	
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-    @param: row - the row being incremented
-	@param: column - the column being incremented
-	@param: numRows - the current board's number of rows; indicates if the row value is valid
-	@param: numColumns - the current board's number of columns; indicates if the column value is
-        valid
+	@param: CurrentProfile - pointer to the current profile structure holding profile information
 	
-	Precondition: The current tile's information is accurate. numRows and numColumns are less than
-        MAX_ROWS AND MAX_COLUMNS, respectively.
-
+	Precondition: assumes a game has recently concluded
 */
-void incrementTileState(struct Tile Board[][15], int row, int column, int numRows, int numColumns) {
-    int isValidRow = row >= 0 && row <= numRows - 1;
-    int isValidColumn = column >= 0 && column <= numColumns - 1;
-    int isNotMine = Board[row][column].state != 9;
+void updateStatistics(struct Profile *CurrentProfile) {
+    string20 mode;
+    strcpy(mode, CurrentProfile->CurrentGame.mode);
+    int seconds = CurrentProfile->CurrentGame.seconds;
 
-    if (isValidRow && isValidColumn && isNotMine) { // valid tile to increment
-        Board[row][column].state++;
+    if (strcmp(CurrentProfile->CurrentGame.outcome, WON_OUTCOME) == 0) { // won
+        if (strcmp(mode, EASY_MODE) == 0) {
+            CurrentProfile->EasyStats.won++;
+            CurrentProfile->EasyStats.totalSeconds += seconds;
+        }
+        else if (strcmp(mode, DIFFICULT_MODE) == 0) {
+            CurrentProfile->DifficultStats.won++;
+            CurrentProfile->DifficultStats.totalSeconds += seconds;
+        }
+        else if (strcmp(mode, CUSTOM_MODE) == 0) {
+            CurrentProfile->CustomStats.won++;
+            CurrentProfile->CustomStats.totalSeconds += seconds;
+        }
+    }
+    else { // lost/quit
+        if (strcmp(mode, EASY_MODE) == 0) {
+            CurrentProfile->EasyStats.lost++;
+        }
+        else if (strcmp(mode, DIFFICULT_MODE) == 0) {
+            CurrentProfile->DifficultStats.lost++;
+        }
+        else if (strcmp(mode, CUSTOM_MODE) == 0) {
+            CurrentProfile->CustomStats.lost++;
+        }
     }
 }
 
 
 /*
-    @brief: initializes the states of the entire board based on the locations of all the mines
-		  
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-    @param: mineLocations - array of integers representing mine locations
-	@param: rows - number of rows of the board
-	@param: columns - number of columns of the board
-	@param: numMines - number of mines on the board
+	@brief: exchanges the contents of two games, including ownership of their board buffers
 	
-	Precondition: mineLocations contains the locations of all the mines.
+	@param: Game1 - pointer to the first game
+	@param: Game2 - pointer to the second game
 */
-void initializeTileStates(struct Tile Board[10][15], int mineLocations[], int rows, int columns, int numMines) {
-    int i;
-    int mineRow, mineColumn;
-
-    for (i = 0; i < numMines; i++) {
-        mineRow = mineLocations[i] / 100;
-        mineColumn = mineLocations[i] % 100;
-
-        incrementTileState(Board, mineRow - 1, mineColumn - 1, rows, columns); // tile northwest
-        incrementTileState(Board, mineRow - 1, mineColumn, rows, columns); // tile north
-        incrementTileState(Board, mineRow - 1, mineColumn + 1, rows, columns); // tile northeast
-        incrementTileState(Board, mineRow, mineColumn - 1, rows, columns); // tile west
-        incrementTileState(Board, mineRow, mineColumn + 1, rows, columns); // tile east
-        incrementTileState(Board, mineRow + 1, mineColumn - 1, rows, columns); // tile southwest
-        incrementTileState(Board, mineRow + 1, mineColumn, rows, columns); // tile south
-        incrementTileState(Board, mineRow + 1, mineColumn + 1, rows, columns); // tile southeast
-    }
+void swapGames(struct Game *Game1, struct Game *Game2) {
+    struct Game temp = *Game1;
+    *Game1 = *Game2;
+    *Game2 = temp;
 }
 
 
 /*
-    @brief: prints a game board given information about it
+	@brief: updates the current profile's struct's recent games
 	
-	@param: Board - a 2-dimensional array of tiles representing a game board
-	@param: rows - number of rows of the board
-	@param: columns - number of columns of the board
-	@param: currRow - indicates the row of the cursor ( > < )
-	@param: currColumn - indicates the column of the cursor ( > < )
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-
-    Precondition: currRow and currColumn are positive and within range if the user's cursor is to
-        be printed.
+	@param: CurrentProfile - pointer to the current profile structure holding profile information
+	
+	Precondition: assumes a game has recently concluded
 */
-void printBoard(struct Tile Board[][15], int rows, int columns, int currRow, int currColumn, int theme) {
-    int i, j, k;
-    int state;
+void updateRecentGames(struct Profile *CurrentProfile) {
+    // games are swapped rather than copied so that every board buffer keeps exactly one owner
+    if (!CurrentProfile->CurrentGame.exists) return;
 
-    // print the column numbers
-    printf("\n%7d", 1);
-    for (i = 2; i <= columns; i++)
-        printf("%4d", i);
-    printf("\n");
+    // set recent game 3's details to that of recent game 2's
+    if (CurrentProfile->RecentGame2.exists) {
+        swapGames(&CurrentProfile->RecentGame3, &CurrentProfile->RecentGame2);
+    }
 
-    // print the upper border
-    printf(" \x1b[1m\x1b[30m%4c%c%c%c\x1b[0m", 218, 196, 196, 196);
-    for (i = 0; i < columns - 1; i++)
-        printf("\x1b[1m\x1b[30m%c%c%c%c\x1b[0m", 194, 196, 196, 196);
-    printf("\x1b[1m\x1b[30m%c\x1b[0m\n", 191);
+    // set recent game 2's details to that of recent game 1's
+    if (CurrentProfile->RecentGame1.exists) {
+        swapGames(&CurrentProfile->RecentGame2, &CurrentProfile->RecentGame1);
+    }
 
-    // print the body
-    for (i = 0; i < rows; i++) {
-        printf(" %-3d", i + 1);
-
-        for (j = 0; j < columns; j++) {
-            state = Board[i][j].state;
-
-            printf("\x1b[1m\x1b[30m%c\x1b[0m", 179);
-
-            if (i == currRow && j == currColumn) {
-                printf("\x1b[1m\x1b[37m>\x1b[0m");
-            }
-            else {
-                printf(" ");
-            }
-            
-            if (Board[i][j].isRevealed) { // tile is revealed; negate to reveal/hide
-                if (state == 0) { // empty; no nearby mines
-                    printf(" ");
-                }
-                else if (state >= 1 && state <= 8) { // 1 - 8 nearby mines
-                    printf("\x1b[1m\x1b[37m%d\x1b[0m", state);
-                }
-                else if (state == 9) { // mine
-                    printf("\x1b[1m\x1b[31m%c\x1b[0m", 233);
-                }
-                else if (state == 10) { // exploded mine
-                    printf("\x1b[1m\x1b[31m%c\x1b[0m", 254);
-                }
-            }
-            else if (Board[i][j].isFlagged) { // tile is flagged
-                printf("\x1b[1m\x1b[37m%c\x1b[0m", 219);
-            }
-            else { // tile is not yet inspected
-				if (theme == 1) { // cyan
-                	printf("\x1b[1m\x1b[36m%c\x1b[0m", 219);
-            	}
-            	else if (theme == 2) { // bright red
-            		printf("\x1b[1m\x1b[31m%c\x1b[0m", 219);
-				}
-				else if (theme == 3) { // bright green
-					printf("\x1b[1m\x1b[32m%c\x1b[0m", 219);
-				}
-                else if (theme == 4) { // dark purple
-                    printf("\x1b[1m\x1b[35m%c\x1b[0m", 219);
-                }
-            }
-
-            if (i == currRow && j == currColumn) {
-                printf("\x1b[1m\x1b[37m<\x1b[0m");
-            }
-            else {
-                printf(" ");
-            }
-        }
-
-        printf("\x1b[1m\x1b[30m%c\x1b[0m\n", 179);
-
-        if (i < rows - 1) {
-            // print the middle border
-            printf(" \x1b[1m\x1b[30m%4c%c%c%c\x1b[0m", 195, 196, 196, 196);
-            for (k = 0; k < columns - 1; k++)
-                printf("\x1b[1m\x1b[30m%c%c%c%c\x1b[0m", 197, 196, 196, 196);
-            printf("\x1b[1m\x1b[30m%c\x1b[0m\n", 180);
-        }
-    }
-
-    // print the lower border
-    printf(" \x1b[1m\x1b[30m%4c%c%c%c\x1b[0m", 192, 196, 196, 196);
-    for (i = 0; i < columns - 1; i++)
-        printf("\x1b[1m\x1b[30m%c%c%c%c\x1b[0m", 193, 196, 196, 196);
-    printf("\x1b[1m\x1b[30m%c\x1b[0m\n", 217);
+    // set recent game 1's details to that of the current game's
+    swapGames(&CurrentProfile->RecentGame1, &CurrentProfile->CurrentGame);
+
+    // reset current board's details
+    CurrentProfile->CurrentGame.exists = 1;
+    clearBoard(&CurrentProfile->CurrentGame.Board, 0, 0);
+    strcpy(CurrentProfile->CurrentGame.mode, "");
+    strcpy(CurrentProfile->CurrentGame.outcome, "");
+    CurrentProfile->CurrentGame.seconds = 0;
 }
 
 
 /*
-    @brief: detects key presses, allowing the user to utilize keys to navigate through the board
+	@brief: converts a tile into a 3-4 digit code for storing information
 	
-	@param: currRow - pointer to the current row position of the cursor ( > < )
-	@param: currColumn - pointer to the current column position of the cursor ( > < )
-	@param: rows - number of rows of the board, also serves as a limit for out of bounds cursor
-	@param: columns - number of columns of the board, also serves as a limit for out of bounds cursor
+	@param: row - the row of the tile
+	@param: column - the column of the tile
+	@param: Board - pointer to the board where the tile belongs
 	
-	@return: the ASCII value of the pressed key
-*/
-int detectKeyPress(int *currRow, int *currColumn, int rows, int columns) {
-    int key = getch();
-
-    if (key == ARROW_VALUE) { // arrow key press
-        key = getch();
-
-        if (key == UP_VALUE) { // up arrow key
-            if (*currRow != 0) {
-                (*currRow)--;
-            }
-        }
-        else if (key == DOWN_VALUE) { // down arrow key
-            if (*currRow != rows - 1) {
-                (*currRow)++;
-            }
-        }
-        else if (key == LEFT_VALUE) { // left arrow key
-            if (*currColumn != 0) {
-                (*currColumn)--;
-            }
-        }
-        else if (key == RIGHT_VALUE) { // right arrow key
-            if (*currColumn != columns - 1) {
-                (*currColumn)++;
-            }
-        }
-    }
+	@return: 3-4 digit integer representing the tile's code
 
-    return key;
+    Precondition: assumes row and column are not out of bounds
+*/
+int getTileCode(int row, int column, struct Board *Board) {
+    int code = 0;
+    code += getTileState(Board, row, column) * 100;
+    code += isTileFlagged(Board, row, column) * 10;
+    code += isTileRevealed(Board, row, column);
+    return code;
 }
 
 
 /*
-    @brief: reveals a tile; continues revealing tiles adjacent to it if it is a blank
-	
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-	@param: rows - number of rows of the board; helps determine if tile is out of bounds
-	@param: columns - number of columns of the board; helps determine if tile is out of bounds
-	@param: row - the row of the tile inspected
-	@param: column - the column of the tile inspected
+	@brief: restores a tile from its 3-4 digit code; the inverse of getTileCode
 	
-	Precondition: The board information is accurate.
-*/
-void revealTiles(struct Tile Board[][15], int rows, int columns, int row, int column) {
-    int validRow = row >= 0 && row <= rows - 1;
-    int validColumn = column >= 0 && column <= columns - 1;
+	@param: row - the row of the tile
+	@param: column - the column of the tile
+	@param: Board - pointer to the board where the tile belongs
+	@param: code - 3-4 digit integer representing the tile's code
 
-    if (!validRow || !validColumn) return;
-    if (Board[row][column].isRevealed) return;
-    Board[row][column].isRevealed = 1;
-    if (Board[row][column].state != 0) return;
+    Precondition: assumes row and column are not out of bounds
+*/
+void setTileCode(int row, int column, struct Board *Board, int code) {
+    int state = code / 100;
 
-    // at this point, the tile is confirmed to be an unrevealed blank, triggering the cascading
-    revealTiles(Board, rows, columns, row - 1, column - 1); // tile northwest
-    revealTiles(Board, rows, columns, row - 1, column); // tile north
-    revealTiles(Board, rows, columns, row - 1, column + 1); // tile northeast
-    revealTiles(Board, rows, columns, row, column - 1); // tile west
-    revealTiles(Board, rows, columns, row, column + 1); // tile east
-    revealTiles(Board, rows, columns, row + 1, column - 1); // tile southwest
-    revealTiles(Board, rows, columns, row + 1, column); // tile south
-    revealTiles(Board, rows, columns, row + 1, column + 1); // tile southeast
+    setTileMine(Board, row, column, state == 9 || state == 10);
+    Board->states[getTileIndex(Board, row, column)] = state;
+    setTileFlagged(Board, row, column, code / 10 % 10);
+    setTileRevealed(Board, row, column, code % 10);
 }
 
 
 /*
-	@brief: determines the current state of the game (ongoing/won/lost)
-	
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-	@param: rows - indicates the number of rows
-	@param: column - indicates the number of columns
-	@param: mineLocations - array of integers representing mine locations
-	@param: numMines - indicates the total number of mines
+	@brief: access the current profile's text file and update it in accordance with the struct's
+        contents
 	
-	@return: 0 - game is ongoing
-			 1 - won
-			 2 - lost
-*/
-int getGameState(struct Tile Board[][15], int rows, int columns, int mineLocations[], int numMines) {
+	@param: CurrentProfile - pointer to the current profile struct that we will be using to update
+        their text file
+
+    Precondition: the current profile name corresponds with the actual profile being updated
+*/	
+void updateProfile(struct Profile *CurrentProfile) {
+    FILE *fp;
     int i, j;
-    int mineRow, mineColumn;
 
-    // check if a mine has been inspected
-    for (i = 0; i < numMines; i++) {
-        mineRow = mineLocations[i] / 100;
-        mineColumn = mineLocations[i] % 100;
+    string100 directory = PROFILES_FOLDER;
+    strcat(directory, CurrentProfile->name);
+    strcat(directory, ".txt");
+
+    updateStatistics(CurrentProfile);
+    updateRecentGames(CurrentProfile);
+
+    fp = fopen(directory, "w");
+    if (fp == NULL) return;
+
+    struct Game *RecentGame1 = &CurrentProfile->RecentGame1;
+    struct Game *RecentGame2 = &CurrentProfile->RecentGame2;
+    struct Game *RecentGame3 = &CurrentProfile->RecentGame3;
+
+    // player information and statistics
+    fprintf(fp, "%s\n%d\n%d\n\n", CurrentProfile->name, CurrentProfile->creationDate, CurrentProfile->lifetimeGames);
+    fprintf(fp, "%d\n%d\n%d\n\n", CurrentProfile->EasyStats.totalSeconds, CurrentProfile->EasyStats.won,
+        CurrentProfile->EasyStats.lost);
+    fprintf(fp, "%d\n%d\n%d\n\n", CurrentProfile->DifficultStats.totalSeconds, CurrentProfile->DifficultStats.won,
+        CurrentProfile->DifficultStats.lost);
+    fprintf(fp, "%d\n%d\n%d\n\n", CurrentProfile->CustomStats.totalSeconds, CurrentProfile->CustomStats.won,
+        CurrentProfile->CustomStats.lost);
 
-        if (Board[mineRow][mineColumn].isRevealed) { // a mine has been revealed
-            Board[mineRow][mineColumn].state = 10;
-            return 2; // game is lost
+    // recent game 1
+    fprintf(fp, "%d\n", RecentGame1->exists);
+    if (RecentGame1->exists) {
+        fprintf(fp, "%d %d\n", RecentGame1->Board.rows, RecentGame1->Board.columns);
+        for (i = 0; i < RecentGame1->Board.rows; i++) {
+            for (j = 0; j < RecentGame1->Board.columns; j++) {
+                fprintf(fp, "%d ", getTileCode(i, j, &RecentGame1->Board));
+            }
+            fprintf(fp, "\n");
         }
+        fprintf(fp, "%s\n%s\n", RecentGame1->mode, RecentGame1->outcome);
+        fprintf(fp, "%d\n", RecentGame1->seconds);
     }
 
-    // check if all non-mines have been inspected
-    for (i = 0; i < rows; i++) {
-        for (j = 0; j < columns; j++) {
-            if (Board[i][j].state != 9 && !Board[i][j].isRevealed) // not all non-mine tiles have been revealed
-                return 0;  // game is ongoing
+    // recent game 2
+    fprintf(fp, "\n%d\n", RecentGame2->exists);
+    if (RecentGame2->exists) {
+        fprintf(fp, "%d %d\n", RecentGame2->Board.rows, RecentGame2->Board.columns);
+        for (i = 0; i < RecentGame2->Board.rows; i++) {
+            for (j = 0; j < RecentGame2->Board.columns; j++) {
+                fprintf(fp, "%d ", getTileCode(i, j, &RecentGame2->Board));
+            }
+            fprintf(fp, "\n");
+        }
+        fprintf(fp, "%s\n%s\n", RecentGame2->mode, RecentGame2->outcome);
+        fprintf(fp, "%d\n", RecentGame2->seconds);
+    }
+
+    // recent game 3
+    fprintf(fp, "\n%d\n", RecentGame3->exists);
+    if (RecentGame3->exists) {
+        fprintf(fp, "%d %d\n", RecentGame3->Board.rows, RecentGame3->Board.columns);
+        for (i = 0; i < RecentGame3->Board.rows; i++) {
+            for (j = 0; j < RecentGame3->Board.columns; j++) {
+                fprintf(fp, "%d ", getTileCode(i, j, &RecentGame3->Board));
+            }
+            fprintf(fp, "\n");
         }
+        fprintf(fp, "%s\n%s\n", RecentGame3->mode, RecentGame3->outcome);
+        fprintf(fp, "%d\n", RecentGame3->seconds);
     }
 
-    return 1; // all non-mine tiles have been revealed; game is won
+    fclose(fp);
 }
 
 
 /*
-    @brief: sets the isRevealed value of all mines to a particular value; effectively hides/reveals
-        all mines
+	@brief: initializes the values of the current profile's information and statistics to default
+        values, except for the creation date
 	
-	@param: visibility - new value that all mines' isRevealed members will be set to
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-	@param: mineLocations - array of integers representing mine locations
-	@param: numMines - total number of mines
+	@param: CurrentProfile - pointer to the current profile's struct that we want to initialize
+	@param: name - the profile's name
 
-    Precondition: Assumes visibility is 1 or 0.
+    Precondition: The profile is being created or reset.
 */
-void setMineVisibility(int visibility, struct Tile Board[][15], int mineLocations[], int numMines) {
-    int i;
-    int mineRow, mineColumn;
+void initializeProfile(struct Profile *CurrentProfile, char name[]) {
+    struct Game *CurrentGame = &CurrentProfile->CurrentGame;
 
-    for (i = 0; i < numMines; i++) {
-        mineRow = mineLocations[i] / 100;
-        mineColumn = mineLocations[i] % 100;
+    strcpy(CurrentProfile->name, name);
+    CurrentProfile->lifetimeGames = 0;
 
-        Board[mineRow][mineColumn].isRevealed = visibility; // reveal the mine
-    }
-}
+    CurrentProfile->EasyStats.totalSeconds = 0;
+    CurrentProfile->EasyStats.won = 0;
+    CurrentProfile->EasyStats.lost = 0;
 
+    CurrentProfile->DifficultStats.totalSeconds = 0;
+    CurrentProfile->DifficultStats.won = 0;
+    CurrentProfile->DifficultStats.lost = 0;
 
-/*
-    @brief: uses the binary insertion sort algorithm to sort an array of record times for the
-        leaderboard
+    CurrentProfile->CustomStats.totalSeconds = 0;
+    CurrentProfile->CustomStats.won = 0;
+    CurrentProfile->CustomStats.lost = 0;
 
-    @param: name - name of the potential record setter
-    @param: time - time of the potential record setter
-    @param: names - array of record-setting names for the leaderboard being updated
-    @param: times - array of record-setting times (in seconds) for the leaderboard being updated
-    @param: numRecords - pointer to the number of records currently existing in the leaderboard
+    CurrentGame->exists = 0;
+    clearBoard(&CurrentGame->Board, 0, 0);
+    strcpy(CurrentGame->mode, "");
+    strcpy(CurrentGame->outcome, "");
+    CurrentGame->seconds = 0;
 
-    @return: 1 to MAX_RECORDS - the rank of the new record set
-             0 - no new records set
+    CurrentProfile->RecentGame1.exists = 0;
+    CurrentProfile->RecentGame2.exists = 0;
+    CurrentProfile->RecentGame3.exists = 0;
 
-    Precondition: numRecords is less than or equal to MAX_RECORDS. times is arranged in increasing
-        order and names contains names corresponding to the times they set.
+    updateProfile(CurrentProfile);
+}
+
+
+/*
+    @brief: initializes the values of the current leaderboard's statistics to default values
+
+    @param: CurrentLeaderboard - pointer to the leaderboard struct containing information regarding
+        the top records for each game mode
+    		
+    Precondition: MAX_RECORDS is accurate.
 */
-int updateRecord(string20 name, int time, string20 names[], int times[], int *numRecords) {
+void initializeLeaderboard(struct Leaderboard *CurrentLeaderboard) {
     int i;
-    int index = 0;
-    int high = *numRecords - 1;
-    int mid;
-	
-    while (index <= high) { // determines the index of the first element less than time
-        mid = (index + high) / 2;
-
-        if (times[mid] <= time) {
-            index = mid + 1;
-        }
-        else {
-            high = mid - 1;
-        }
-    }
 
-    if (index == MAX_RECORDS) return -1;
+    struct Records *EasyRecords = &CurrentLeaderboard->EasyRecords;
+    struct Records *DifficultRecords = &CurrentLeaderboard->DifficultRecords;
+    struct Records *CustomRecords = &CurrentLeaderboard->CustomRecords;
 
-    for (i = MAX_RECORDS - 1; i > index; i--) { // shifts the lower records to the right
-        strcpy(names[i], names[i - 1]);
-        times[i] = times[i - 1];
-    }
+    EasyRecords->numRecords = 0;
+    DifficultRecords->numRecords = 0;
+    CustomRecords->numRecords = 0;
 
-    strcpy(names[index], name); // adds the current information as a record
-    times[index] = time;
+    for (i = 0; i < MAX_RECORDS; i++) {
+        strcpy(EasyRecords->names[i], "");
+        EasyRecords->times[i] = 0;
 
-    if (*numRecords < MAX_RECORDS) (*numRecords)++; // ensures the number of records won't pass MAX_RECORDS
+        strcpy(DifficultRecords->names[i], "");
+        DifficultRecords->times[i] = 0;
 
-    return index + 1; // the rank of the newly set record; 0 if no record is set
+        strcpy(CustomRecords->names[i], "");
+        CustomRecords->times[i] = 0;
+    }
 }
 
 
 /*
-    @brief: updates the leaderboard structure then the text file based on the structure information
-	
-	@param: mode - the recently concluded game's mode
-    @param: outcome - the recently concluded game's outcome
-	@param: name - the player name of the recently concluded game
-	@param: seconds - the recently concluded game's time in seconds
-	@param: CurrentLeaderboard - pointer to the current leaderboard struct that we want to update
+	@brief: extracts information from leaderboard.txt and stores it into leaderboard struct
 	
-	@return: 0 - game did not set a new record | leaderboard file failed to open
-			 rank - rank of the new record set
-
-    Precondition: LEADERBOARD_DIRECTORY is accurate. rank obtained from updateRecord is accurate.
+	@param: CurrentLeaderboard - pointer to the current leaderboard struct that we want to store
+        information into
+    
+    Precondition: The leaderboard text file is formatted correctly. LEADERBOARD_DIRECTORY is
+        accurate.
 */
-int updateLeaderboard(string20 mode, string20 outcome, string20 name, int seconds, struct Leaderboard *CurrentLeaderboard) {
-    int i;
-    int rank;
+void loadLeaderboard(struct Leaderboard *CurrentLeaderboard) {
     FILE *fp;
+    int i;
 
-    if (strcmp(outcome, WON_OUTCOME) != 0) return 0;
-
-    struct Records *EasyRecords = &CurrentLeaderboard->EasyRecords;
-    struct Records *DifficultRecords = &CurrentLeaderboard->DifficultRecords;
-    struct Records *CustomRecords = &CurrentLeaderboard->CustomRecords;
+    fp = fopen(LEADERBOARD_DIRECTORY, "r");
+    if (fp == NULL) {
+        fp = fopen(LEADERBOARD_DIRECTORY, "w");
+        fprintf(fp, "0\n\n0\n\n0\n");
+        fclose(fp);
 
-    if (strcmp(mode, EASY_MODE) == 0) { // update easy leaderboard
-        rank = updateRecord(name, seconds, EasyRecords->names, EasyRecords->times, &EasyRecords->numRecords);
+        loadLeaderboard(CurrentLeaderboard);
+        return;
     }
-    else if (strcmp(mode, DIFFICULT_MODE) == 0) { // update difficult leaderboard
-        rank = updateRecord(name, seconds, DifficultRecords->names, DifficultRecords->times,
-            &DifficultRecords->numRecords);
+
+    // easy leaderboard
+    fscanf(fp, "%d", &CurrentLeaderboard->EasyRecords.numRecords);
+    for (i = 0; i < CurrentLeaderboard->EasyRecords.numRecords; i++) {
+        fscanf(fp, "%s", CurrentLeaderboard->EasyRecords.names[i]);
+        fscanf(fp, "%d", &CurrentLeaderboard->EasyRecords.times[i]);
     }
-    else if (strcmp(mode, CUSTOM_MODE) == 0) { // update custom leaderboard
-        rank = updateRecord(name, seconds, CustomRecords->names, CustomRecords->times, &CustomRecords->numRecords);
+
+    // difficult leaderboard
+    fscanf(fp, "%d", &CurrentLeaderboard->DifficultRecords.numRecords);
+    for (i = 0; i < CurrentLeaderboard->DifficultRecords.numRecords; i++) {
+        fscanf(fp, "%s", CurrentLeaderboard->DifficultRecords.names[i]);
+        fscanf(fp, "%d", &CurrentLeaderboard->DifficultRecords.times[i]);
+    }
+    
+    // custom leaderboard
+    fscanf(fp, "%d", &CurrentLeaderboard->CustomRecords.numRecords);
+    for (i = 0; i < CurrentLeaderboard->CustomRecords.numRecords; i++) {
+        fscanf(fp, "%s", CurrentLeaderboard->CustomRecords.names[i]);
+        fscanf(fp, "%d", &CurrentLeaderboard->CustomRecords.times[i]);
     }
 
-    fp = fopen(LEADERBOARD_DIRECTORY, "w");
-    if (fp == NULL) return 0;
+    fclose(fp);
+}
 
-    fprintf(fp, "%d\n", EasyRecords->numRecords);
-    for (i = 0; i < EasyRecords->numRecords; i++) {
-        fprintf(fp, "%s %d\n", EasyRecords->names[i], EasyRecords->times[i]);
+
+/*
+    @brief: clears the input buffer after a user response
+*/
+void clearInputBuffer() {
+    int c;
+    do {
+        c = getchar();
+    } while (c != '\n' && c != EOF);
+
+    if (isBatch) {
+        if (c == EOF) endBatch("eof"); // the script ended before the program did
+        Batch.numInputs++;
     }
+}
 
-    fprintf(fp, "\n%d\n", DifficultRecords->numRecords);
-    for (i = 0; i < DifficultRecords->numRecords; i++) {
-        fprintf(fp, "%s %d\n", DifficultRecords->names[i], DifficultRecords->times[i]);
+
+/*
+	@brief: sorts the profile names in alphabetical order using the selection sort algorithm
+	
+	@param: ProfileNames - array containing the list of existing profiles
+	@param: n - indicates how many profiles are in the array
+*/
+void sortProfileNames(string20 ProfileNames[], int n) {
+    int i, j;
+    int index;
+    string20 temp;
+
+    for (i = 0; i < n - 1; i++) {
+        index = i;
+
+        for (j = i + 1; j < n; j++) {
+            if (strcmp(ProfileNames[j], ProfileNames[index]) < 0) {
+                index = j;
+            }
+        }
+
+        if (i != index) {
+            strcpy(temp, ProfileNames[i]);
+            strcpy(ProfileNames[i], ProfileNames[index]);
+            strcpy(ProfileNames[index], temp);
+        }
     }
+}
 
-    fprintf(fp, "\n%d\n", CustomRecords->numRecords);
-    for (i = 0; i < CustomRecords->numRecords; i++) {
-        fprintf(fp, "%s %d\n", CustomRecords->names[i], CustomRecords->times[i]);
+
+/*
+	@brief: stores the profiles in profiles directory into the ProfileNames[] array
+	
+	@param: ProfileNames - array of strings containing the existing profile names
+	
+    Precondition: PROFILES_DIRECTORY is accurate.
+
+	@return: the number of profiles successfully read from the profiles text file
+*/
+int getProfileNames(string20 ProfileNames[]) {
+    FILE *fp;
+    string20 name;
+    int numProfiles = 0;
+
+    fp = fopen(PROFILES_DIRECTORY, "r");
+
+    if (fp == NULL) {
+        fp = fopen(PROFILES_DIRECTORY, "w");
+        fclose(fp);
+        return getProfileNames(ProfileNames);
+    }
+
+    while (fscanf(fp, "%s", name) == 1) {
+        if (strcmp(name, "") != 0) {
+            strcpy(ProfileNames[numProfiles++], name);
+        }
     }
 
+    sortProfileNames(ProfileNames, numProfiles);
+
     fclose(fp);
-    return rank;
+    return numProfiles;
 }
 
 
 /*
-    @brief: Guides the user in game mode selection and game proper. Handles the underlying game
-        generation process.
+    @brief: prints a divider consisting of several dashes to aid in display formatting
+*/
+void printDivider() {
+    printf(" \x1b[1m\x1b[37m----------------------------------------------------------------------------\x1b[0m");
+}
+
+
+/*
+	@brief: prints a list of existing profiles
 	
-	@param: CurrentProfile - pointer to the current profile structure storing current profile
-        information
-	@param: CurrentLeaderboard - pointer to the current leaderboard struct that we want to update
-        after a game has concluded
 	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void printProfiles(int theme) {
+    int i;
+    string20 profileNames[MAX_PROFILES];
+    int numProfiles = getProfileNames(profileNames);
 	
-	Precondition: The user chose to begin a game from the main menu.
+	printEvade(theme);
+
+    printf("\n Here are the existing profiles:\n\n");
+    for (i = 0; i < numProfiles; i++) {
+        printf(" %d.) %s\n", i + 1, profileNames[i]);
+    }
+}
+
+
+/*
+	@brief: capitalizes all the letters of a string
+	
+	@param: string - the string to be capitalized
+
+    Precondition: The string only consists of letters from the English alphabet.
 */
-void gameHandler(struct Profile *CurrentProfile, struct Leaderboard *CurrentLeaderboard, int theme) {
-    char userResponse;
-    int keyValue;
-    int mineLocations[35];
-    struct Game *CurrentGame = &CurrentProfile->CurrentGame;
+void toUpperCaseString(string20 string) {
+    for (int i = 0; i < strlen(string); i++) {
+        string[i] = toupper(string[i]);
+    }
+}
 
-    int mines = 0;
-    int gameState = 0;
-    int currRow = 0;
-    int currColumn = 0;
 
-    time_t startTime, endTime;
-    int timeTaken;
-    int rank;
+/*	
+	@brief: checks if a particular profile exists
+	
+	@param: name - the name being checked
+	
+	@return: 1 - profile exists
+			 0 - profile does not exist
+	
+*/
+int profileExists(string20 name) {
+    int i;
+    string20 ProfileNames[10];
+    int numProfiles = getProfileNames(ProfileNames);
 
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
+    toUpperCaseString(name);
 
-        printf("\n");
-        printDivider();
-        printf("\n");
-		
-		printEvade(theme);
-        printf("\n");
-		
-        printf(" There are two game options:\n\n");
-        printf(" [a] Classic Game\n [b] Custom Game\n\n");
+    for (i = 0; i < numProfiles; i++) {
+        if (strcmp(name, ProfileNames[i]) == 0) {
+            return 1;
+        }
+    }
 
-        printDivider();
-        printf("\n\n");
+    return 0;
+}
+
+
+/*
+	@brief: extracts information from the current profile's text file and stores it into the current
+        profile structure
+	
+	@param: CurrentProfile - pointer to the structure holding the current profile information
+	@param: name - name of the profile
+	
+	Precondition: The profile text file being loaded stores the profile information in a correct,
+        accurate format.
+	
+*/
+void loadProfile(struct Profile *CurrentProfile, string20 name) {
+    FILE *fp;
+    int i, j;
+    int code;
+    int rows, columns;
+
+    struct Game *RecentGame1 = &CurrentProfile->RecentGame1;
+    struct Game *RecentGame2 = &CurrentProfile->RecentGame2;
+    struct Game *RecentGame3 = &CurrentProfile->RecentGame3;
+
+    string100 directory = PROFILES_FOLDER;
+    strcat(directory, name);
+    strcat(directory, ".txt");
+
+    fp = fopen(directory, "r");
+    if (fp == NULL) {
+        CurrentProfile->creationDate = getDateCode();
+        initializeProfile(CurrentProfile, name);
+        loadProfile(CurrentProfile, name);
+        return;
+    }
+
+    // current profile information
+    fscanf(fp, "%s", CurrentProfile->name);
+    fscanf(fp, "%d", &CurrentProfile->creationDate);
+    fscanf(fp, "%d", &CurrentProfile->lifetimeGames);
+
+    // easy statistics
+    fscanf(fp, "%d", &CurrentProfile->EasyStats.totalSeconds);
+    fscanf(fp, "%d", &CurrentProfile->EasyStats.won);
+    fscanf(fp, "%d", &CurrentProfile->EasyStats.lost);
+
+    // difficult statistics
+    fscanf(fp, "%d", &CurrentProfile->DifficultStats.totalSeconds);
+    fscanf(fp, "%d", &CurrentProfile->DifficultStats.won);
+    fscanf(fp, "%d", &CurrentProfile->DifficultStats.lost);
+
+    // custom statistics
+    fscanf(fp, "%d", &CurrentProfile->CustomStats.totalSeconds);
+    fscanf(fp, "%d", &CurrentProfile->CustomStats.won);
+    fscanf(fp, "%d", &CurrentProfile->CustomStats.lost);
+
+    // recent game 1
+    fscanf(fp, "%d", &RecentGame1->exists);
+    if (RecentGame1->exists) { 
+        fscanf(fp, "%d", &rows);
+        fscanf(fp, "%d", &columns);
+        clearBoard(&RecentGame1->Board, rows, columns);
+
+        // recent game 1 board
+        for (i = 0; i < rows; i++) {
+            for (j = 0; j < columns; j++) {
+                fscanf(fp, "%d", &code);
+                setTileCode(i, j, &RecentGame1->Board, code);
+            }
+        }
+
+        fscanf(fp, "%s", RecentGame1->mode);
+        fscanf(fp, "%s", RecentGame1->outcome);
+        fscanf(fp, "%d", &RecentGame1->seconds);
+    }
+
+    // recent game 2
+    fscanf(fp, "%d", &RecentGame2->exists);
+    if (RecentGame2->exists) { 
+        fscanf(fp, "%d", &rows);
+        fscanf(fp, "%d", &columns);
+        clearBoard(&RecentGame2->Board, rows, columns);
+
+        // recent game 2 board
+        for (i = 0; i < rows; i++) {
+            for (j = 0; j < columns; j++) {
+                fscanf(fp, "%d", &code);
+                setTileCode(i, j, &RecentGame2->Board, code);
+            }
+        }
+
+        fscanf(fp, "%s", RecentGame2->mode);
+        fscanf(fp, "%s", RecentGame2->outcome);
+        fscanf(fp, "%d", &RecentGame2->seconds);
+    }
+
+    // recent game 3
+    fscanf(fp, "%d", &RecentGame3->exists);
+    if (RecentGame3->exists) { 
+        fscanf(fp, "%d", &rows);
+        fscanf(fp, "%d", &columns);
+        clearBoard(&RecentGame3->Board, rows, columns);
+
+        // recent game 3 board
+        for (i = 0; i < rows; i++) {
+            for (j = 0; j < columns; j++) {
+                fscanf(fp, "%d", &code);
+                setTileCode(i, j, &RecentGame3->Board, code);
+            }
+        }
+
+        fscanf(fp, "%s", RecentGame3->mode);
+        fscanf(fp, "%s", RecentGame3->outcome);
+        fscanf(fp, "%d", &RecentGame3->seconds);
+    }
+}
+
+
+/*
+    @brief: prompts the user to press enter to return to the main menu
+*/
+void pressEnter() {
+    printf(" Press 'Enter' to return to the Main Menu.");
+    clearInputBuffer();
+}
+
+
+/*
+    @brief: builds the directory of a profile's journal
+
+    @param: name - name of the profile
+    @param: directory - where the directory is written
+*/
+void getJournalDirectory(string20 name, string100 directory) {
+    strcpy(directory, PROFILES_FOLDER);
+    strcat(directory, name);
+    strcat(directory, JOURNAL_SUFFIX);
+}
+
+
+/*
+    @brief: removes the files of the guest profile once the user moves to another profile, so that
+        the next guest does not inherit its unfinished game or the replay of its last game
+*/
+void removeGuestFiles() {
+    string20 name = "GUEST";
+    string100 directory;
+
+    remove(PROFILES_FOLDER "GUEST.txt");
+    remove(PROFILES_FOLDER "GUEST" REPLAY_SUFFIX);
+
+    getJournalDirectory(name, directory);
+    remove(directory);
+}
+
+
+/*
+	@brief: prompts the user to select an existing profile from the profile directory
+	
+	@param: CurrentProfile - pointer to the structure holding the current profile information
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: The list of profiles is accurate.
+*/
+void selectProfile(struct Profile *CurrentProfile, int theme) {
+    string20 profile;
+    int exists;
+
+    do {
+        pace(SHORT_SLEEP);
+        clearScreen();
+
+        printf("\n");
+        printDivider();
+        printf("\n");
+
+        printProfiles(theme);
+
+        printf("\n");
+        printDivider();
+
+        printf("\n\n Enter an existing profile to load (or '0' to return to the main menu): ");
+        scanf("%s", profile);
+        clearInputBuffer();
+
+        if (strcmp(profile, "0") == 0) {
+            return;
+        }
+
+        exists = profileExists(profile);
+        if (!exists) {
+            printf("\n The profile '%s' does not exist.", profile);
+        }
+        
+    } while (!exists);
+
+    // account change processing
+    removeGuestFiles();
+
+    pace(SHORT_SLEEP);
+    printf("\n Successful.");
+    pace(SHORT_SLEEP);
+
+    printf(" The current profile has been changed from '%s' to '%s'.", CurrentProfile->name, profile);
+    loadProfile(CurrentProfile, profile); // load the selected profile's information
+    printResult("profile loaded name=%s", CurrentProfile->name);
+    pace(LONG_SLEEP);
+    
+    printf("\n\n");
+    pressEnter();
+}
+
+
+/*
+    @brief: checks if a profile name is valid
+	
+	@param: name - name of the profile being created
+	
+	@return: 1 - valid profile name
+			 0 - invalid profile name
+*/
+int isValidProfileName(string20 name) {
+    int i;
+    int strLen = strlen(name);
+    int hasGoodLength, isAlphabetic, isNotTaken, isNotReserved;
+
+    toUpperCaseString(name);
+
+    // the name has between 3 to 20 characters
+    hasGoodLength = strLen >= 3 && strLen <= 20;
+
+    // the name only contains letters of the English alphabet
+    isAlphabetic = 1;
+    for (i = 0; i < strLen; i++) {
+        if (!isalpha(name[i])) {
+            isAlphabetic = 0;
+        }
+    }
+
+    // the name has not yet been taken
+    isNotTaken = !profileExists(name);
+
+    // the name has not yet been reserved for the program
+    isNotReserved = strcmp(name, "GUEST") != 0;
+
+    // inform the user of the naming requirements
+    if (!hasGoodLength) {
+        printf("\tThe name must contain between 3 to 20 characters!\n");
+        pace(SHORT_SLEEP);
+    }
+    if (!isAlphabetic) {
+        printf("\tThe name must only contain letters from the English alphabet!\n");
+        pace(SHORT_SLEEP);
+    }
+    if (!isNotTaken) {
+        printf("\tThe name '%s' has already been taken. Please provide another name!\n", name);
+        pace(SHORT_SLEEP);
+    }
+    if (!isNotReserved) {
+        printf("\tThe name '%s' has already been reserved for the program. Please provide another name!\n", name);
+        pace(SHORT_SLEEP);
+    }
+
+    return hasGoodLength && isAlphabetic && isNotTaken && isNotReserved;
+}
+
+
+/*
+    @brief: guides the user in creating a new profile, then creates the corresponding text file and
+        updates the list of profiles
+	
+	@param: CurrentProfile - pointer to the current profile struct holding the current profile's
+        information
+	
+	@return: 1 - successfully created a profile
+			 0 - a profile was not created
+
+    Precondition: MAX_PROFILES is accurate.
+*/
+int createProfile(struct Profile *CurrentProfile, int theme) {
+    FILE *fp;
+    string20 name;
+    string20 ProfileNames[10];
+
+    pace(SHORT_SLEEP);
+
+    // restrict the user from creating a profile if there are at least 10 existing ones
+    if (getProfileNames(ProfileNames) >= MAX_PROFILES) {
+        printf("\n Sorry, you cannot create a new profile as there can only be a maximum of ");
+        printf("%d profiles.", MAX_PROFILES);
+        pace(LONG_SLEEP);
+
+        printf("\n\n");
+        pressEnter();
+        return 0;
+    }
+
+    clearScreen();
+
+    printf("\n");
+    printDivider();
+    printf("\n");
+
+    printProfiles(theme);
+
+    printf("\n");
+    printDivider();
+    printf("\n\n");
+
+    printf(" Requirements:\n\n");
+    printf(" 1.) The name must contain between 3 to 20 characters.\n");
+    printf(" 2.) The name must only contain letters from the English alphabet.\n");
+    printf(" 3.) The name must not have already been taken by an existing profile.\n\n");
+
+    printDivider();
+    printf("\n");
+
+    do {
+        printf("\n Enter a valid name for your profile (or '0' to return to the main menu): ");
+        scanf("%s", name);
+        clearInputBuffer();
+
+        if (strcmp(name, "0") == 0) return 0;
+    } while (!isValidProfileName(name));
+    
+    // initialize the account information, as well as their creation date
+    CurrentProfile->creationDate = getDateCode();
+    initializeProfile(CurrentProfile, name);
+
+    fp = fopen(PROFILES_DIRECTORY, "a");
+    fprintf(fp, "%s\n", CurrentProfile->name);
+    fclose(fp);
+
+    pace(SHORT_SLEEP);
+    printf("\n Successful.");
+    pace(SHORT_SLEEP);
+
+    printf(" The profile '%s' has been created.", name);
+    printResult("profile created name=%s", CurrentProfile->name);
+    pace(LONG_SLEEP);
+    
+    printf("\n\n");
+    pressEnter();
+
+    return 1;
+}
+
+
+/*
+    @brief: prompts the user to confirm their action
+	
+	@return: 1 - user confirms
+			 0 - user does not confirm
+*/
+int confirmAction() {
+    char c;
+
+    do {
+        printf("\n Yes [Y] or No [N]: ");
+        scanf("%c", &c);
+        clearInputBuffer();
+    } while (!(c == 'Y' || c == 'N'));
+
+    return c == 'Y';
+}
+
+
+/*
+    @brief: guides the user in deleting an existing profile; restricts them from deleting the
+        current profile
+
+    @param: name - name of the current profile
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: The list of profile is accurate. PROFILES_DIRECTORY is accurate.
+*/
+void deleteProfile(string20 name, int theme) {
+    FILE *fp;
+    int i;
+    int exists, isCurrent;
+
+    string100 directory = PROFILES_FOLDER;
+    string20 profile;
+    string20 ProfileNames[10];
+    int numProfiles = getProfileNames(ProfileNames);
+
+    do {
+        pace(SHORT_SLEEP);
+        clearScreen();
+
+        printf("\n");
+        printDivider();
+        printf("\n");
+
+        printProfiles(theme);
+
+        printf("\n");
+        printDivider();
+
+        printf("\n\n Enter an existing profile to delete (or '0' to return to the main menu): ");
+        scanf("%s", profile);
+        toUpperCaseString(profile);
+        clearInputBuffer();
+        
+        if (strcmp(profile, "0") == 0) return;
+
+        exists = profileExists(profile);
+        if (!exists) {
+            printf("\n The profile '%s' does not exist.", profile);
+        }
+
+        isCurrent = strcmp(profile, name) == 0;
+        if (isCurrent) {
+            printf("\n You cannot delete '%s' as it is the current profile!", profile);
+        }
+    } while (!exists || isCurrent);
+    
+    printf("\n Are you sure you want to delete the profile '%s'?\n", profile);
+
+    if (!confirmAction()) return;
+
+    fp = fopen(PROFILES_DIRECTORY, "w");
+
+    for (i = 0; i < numProfiles; i++) {
+        if (strcmp(ProfileNames[i], profile) != 0) {
+            fprintf(fp, "%s\n", ProfileNames[i]);
+        }
+    }
+
+    fclose(fp);
+
+    strcat(directory, profile);
+    strcat(directory, ".txt");
+    remove(directory);
+
+    strcpy(directory, PROFILES_FOLDER);
+    strcat(directory, profile);
+    strcat(directory, REPLAY_SUFFIX);
+    remove(directory); // the replay of the profile's last game
+
+    getJournalDirectory(profile, directory);
+    remove(directory); // an unfinished game, which a new profile of the same name must not resume
+
+    pace(SHORT_SLEEP);
+    printf("\n Successful.");
+    pace(SHORT_SLEEP);
+
+    printf(" The profile '%s' has been deleted.", profile);
+    printResult("profile deleted name=%s", profile);
+    pace(LONG_SLEEP);
+    
+    printf("\n\n");
+    pressEnter();
+}
+
+
+/*
+    @brief: guides the user in selecting, creating, or deleting profiles
+	
+	@param: CurrentProfile - pointer to the current profile structure holding the current profile
+        information
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+	
+	Precondition: The list of profiles is accurate.
+*/
+void profileHandler(struct Profile *CurrentProfile, int theme) {
+    char userResponse;
+    string20 ProfileNames[10];
+    
+    getProfileNames(ProfileNames);
+
+    do {
+        pace(SHORT_SLEEP);
+        clearScreen();
+
+        printf("\n");
+        printDivider();
+        printf("\n\n");
+		
+		printMenu(theme);
+		
+        printf("\n\n Current profile: %s\n\n", CurrentProfile->name);
+        printf(" [a] Select an Existing Profile\n [b] Create a New Profile\n [c] Delete an Existing Profile\n\n");
+
+        printDivider();
+
+        printf("\n\n Please input the letter corresponding to your action (a/b/c): ");
+        scanf("%c", &userResponse);
+        clearInputBuffer();
+    } while (!(userResponse >= 'a' && userResponse <= 'c'));
+
+    if (userResponse == 'a') { // user wants to select an existing profile
+        selectProfile(CurrentProfile, theme);
+    }
+    else if (userResponse == 'b') { // user wants to create a new profile
+        if (createProfile(CurrentProfile, theme)) {
+            removeGuestFiles();
+        }
+    }
+    else if (userResponse == 'c') { // user wants to delete an existing profile
+        deleteProfile(CurrentProfile->name, theme);
+        if (!profileExists(CurrentProfile->name)) {
+            initializeProfile(CurrentProfile, "GUEST");
+        }
+    }
+}
+
+
+/*
+    @brief: advances a splitmix64 sequence; used to spread a seed over the state of a generator
+
+    @param: x - pointer to the value being advanced
+
+    @return: the next value of the sequence
+*/
+unsigned long long getSplitMix(unsigned long long *x) {
+    unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+
+/*
+    @brief: seeds a pseudorandom number generator
+
+    @param: Random - pointer to the generator
+    @param: seed - any value; equal seeds give equal sequences
+*/
+void seedRandom(struct Random *Random, unsigned long long seed) {
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        Random->state[i] = getSplitMix(&seed); // never all zero, which xoshiro cannot leave
+    }
+}
+
+
+/*
+    @brief: makes a seed that differs between runs, from the date and the high-resolution clock;
+        with --seed, the seeds are drawn from the seed given instead
+
+    @return: the seed
+*/
+unsigned long long getEntropySeed() {
+    if (isSeeded) return getSplitMix(&fixedSeed); // the same sequence on every run
+
+    return (unsigned long long) time(NULL) * 0x9E3779B97F4A7C15ULL ^ (unsigned long long) getMicroseconds();
+}
+
+
+/*
+    @brief: draws the next 64 random bits of a generator (xoshiro256**)
+
+    @param: Random - pointer to the generator
+
+    @return: the random bits
+*/
+unsigned long long getRandom(struct Random *Random) {
+    unsigned long long *s = Random->state;
+    unsigned long long result = s[1] * 5;
+    unsigned long long t = s[1] << 17;
+
+    result = (result << 7 | result >> 57) * 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = s[3] << 45 | s[3] >> 19;
+
+    return result;
+}
+
+
+/*
+    @brief: draws a random integer below a bound without modulo bias. The high 32 bits of a draw
+        are scaled by the bound with one multiplication; the few draws that would make some
+        results more likely than others are rejected.
+
+    @param: Random - pointer to the generator
+    @param: bound - number of possible results
+
+    @return: an integer in the interval [0, bound - 1], every value equally likely
+
+    Precondition: bound is positive
+*/
+unsigned int getRandomBelow(struct Random *Random, unsigned int bound) {
+    unsigned long long product = (getRandom(Random) >> 32) * bound;
+    unsigned int threshold;
+
+    if ((unsigned int) product < bound) {
+        threshold = -bound % bound; // 2^32 mod bound
+
+        while ((unsigned int) product < threshold) {
+            product = (getRandom(Random) >> 32) * bound;
+        }
+    }
+
+    return product >> 32;
+}
+
+
+/*
+    @brief: generates a pseudorandom integer between a range of numbers
+
+    @param: Random - pointer to the generator to draw from
+    @param: min - minimum number in the range
+    @param: max - maximum number in the range
+
+    @return: pseudorandom-generated integer
+
+    Precondition: assumes parameters are nonnegative and min is less than or equal to max
+*/
+int getRandInt(struct Random *Random, int min, int max) {
+    return min + getRandomBelow(Random, max - min + 1); // randomly generates an integer in the interval [min, max]
+}
+
+
+/*
+    @brief: maps a position among the tiles that may hold mines to the tile itself by skipping the
+        excluded tiles
+
+    @param: position - position among the tiles that may hold mines
+    @param: excluded - flat indices of the excluded tiles, in increasing order
+    @param: numExcluded - number of excluded tiles
+
+    @return: the flat index of the tile
+*/
+int skipExcludedTiles(int position, int excluded[], int numExcluded) {
+    int i;
+
+    for (i = 0; i < numExcluded && excluded[i] <= position; i++) {
+        position++;
+    }
+
+    return position;
+}
+
+
+/*
+    @brief: places mines on random tiles. Mines are picked with Floyd's sampling, which draws one
+        random number per mine and never retries, so placement takes time proportional to the
+        number of mines. When more than half of the tiles are mines, the safe tiles are picked
+        instead and every other tile becomes a mine.
+
+    @param: Board - pointer to the board
+    @param: numMines - number of mines to place
+    @param: Random - pointer to the generator to draw from
+    @param: safeRow - row of a tile whose 3x3 neighborhood is kept free of mines; -1 for none
+    @param: safeColumn - column of that tile
+
+    @return: 1 - successfully placed the mines
+             0 - not enough memory to index the mines (the board has to be cleared again)
+
+    Precondition: The board has no mines, and numMines does not exceed the number of tiles outside
+        the safe neighborhood.
+*/
+int placeMines(struct Board *Board, int numMines, struct Random *Random, int safeRow, int safeColumn) {
+    int i, j;
+    int index;
+    int numTiles = Board->rows * Board->columns;
+    int numWords = getNumWords(Board);
+    int excluded[9];
+    int numExcluded = 0;
+    int numCandidates;
+    int isDense;
+    int numPicked;
+    bitword word;
+
+    // the safe neighborhood, in increasing order of flat index
+    for (i = safeRow - 1; safeRow >= 0 && i <= safeRow + 1; i++) {
+        for (j = safeColumn - 1; j <= safeColumn + 1; j++) {
+            if (i >= 0 && i < Board->rows && j >= 0 && j < Board->columns) {
+                excluded[numExcluded++] = getTileIndex(Board, i, j);
+            }
+        }
+    }
+
+    numCandidates = numTiles - numExcluded;
+    isDense = numMines > numCandidates / 2;
+    numPicked = isDense ? numCandidates - numMines : numMines;
+
+    if (isDense) { // every tile outside the safe neighborhood starts as a mine; picked tiles are cleared
+        memset(Board->Mines.plane, 0xFF, numWords * sizeof(bitword));
+
+        if (numTiles % WORD_BITS != 0) {
+            Board->Mines.plane[numWords - 1] = ((bitword) 1 << (numTiles % WORD_BITS)) - 1;
+        }
+
+        for (i = 0; i < numExcluded; i++) {
+            setBit(Board->Mines.plane, excluded[i], 0);
+        }
+    }
+
+    // step i picks one of the first i + 1 candidates; if that one was picked before, candidate i is
+    // picked instead. Every set of numPicked candidates is equally likely.
+    for (i = numCandidates - numPicked; i < numCandidates; i++) {
+        index = skipExcludedTiles(getRandomBelow(Random, i + 1), excluded, numExcluded);
+
+        if (hasMine(Board, index) == !isDense) { // already picked
+            index = skipExcludedTiles(i, excluded, numExcluded);
+        }
+
+        if (isDense) {
+            setBit(Board->Mines.plane, index, 0);
+        }
+        else if (!addMine(&Board->Mines, index)) {
+            return 0;
+        }
+    }
+
+    if (isDense) { // list the mines left on the plane
+        for (i = 0; i < numWords; i++) {
+            word = Board->Mines.plane[i];
+
+            while (word) {
+                if (!addMine(&Board->Mines, i * WORD_BITS + __builtin_ctzll(word))) return 0;
+                word &= word - 1;
+            }
+        }
+    }
+
+    for (i = 0; i < Board->Mines.numMines; i++) {
+        Board->states[Board->Mines.cells[i]] = 9;
+    }
+
+    Board->numHiddenSafe = numTiles - numMines;
+    return 1;
+}
+
+
+/*
+    @brief: generates a easy/difficult/expert classic game with mines anywhere on the board
+	
+	@param: Board - pointer to the current game board, already cleared to the mode's dimensions
+	@param: numMines - indicates the number of mines (10 - easy, 35 - difficult, 99 - expert)
+	@param: seed - seed of the game; the same seed and dimensions always give the same mines
+
+	@return: 1 - successfully generated the mines
+			 0 - not enough memory to index the mines (the board has to be cleared again)
+
+    Precondition: The board has no mines and numMines is less than the number of tiles.
+*/
+int generateClassicGame(struct Board *Board, int numMines, unsigned long long seed) {
+    struct Random Random;
+
+    seedRandom(&Random, seed);
+    return placeMines(Board, numMines, &Random, -1, -1);
+}
+
+
+/*
+    @brief: prints a list of the existing custom levels
+
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void printLevels(int theme) {
+    FILE *fp;
+    int i;
+    int numLevels;
+    string20 level;
+
+    fp = fopen(LEVELS_DIRECTORY, "r");
+
+    if (fp == NULL) {
+        fp = fopen(LEVELS_DIRECTORY, "w");
+        fclose(fp);
+
+        printLevels(theme);
+        return;
+    }
+
+    fscanf(fp, "%d", &numLevels);
+
+    printf("\n");
+	printEvade(theme);
+
+    printf("\n Here are the existing custom levels:\n\n");
+    for (i = 0; i < numLevels; i++) {
+        fscanf(fp, "%s", level);
+        printf(" %d.) %s\n", i + 1, level);
+    }
+
+    fclose(fp);
+}
+
+
+/*
+    @brief: reads the dimensions and mines of a custom level into a board
+
+    @param: Board - pointer to the board; its dimensions are set from the level
+    @param: fp - the level file, opened for reading
+
+    @return: 1 - successfully read the level
+             0 - the dimensions are unreadable or out of range, the grid ends early, or there is
+                 not enough memory for the board
+
+    Precondition: fp points to the start of a level file, which may come from anywhere.
+*/
+int readLevel(struct Board *Board, FILE *fp) {
+    int i, j;
+    int rows, columns;
+    char c;
+
+    if (fscanf(fp, "%d %d", &rows, &columns) != 2 || rows <= 0 || columns <= 0 || rows > INT_MAX / columns) {
+        return 0;
+    }
+
+    if (!clearBoard(Board, rows, columns)) return 0;
+
+    for (i = 0; i < rows; i++) {
+        for (j = 0; j < columns; j++) {
+            if (fscanf(fp, "%c", &c) != 1) return 0; // the file ends inside the grid
+
+            if (c == 'X') {
+                setTileMine(Board, i, j, 1);
+            }
+            else if (!(c == 'X' || c == '.')) { // some special character was encountered
+                j--;
+            }
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: guides the user in generating a custom game
+	
+	@param: Board - pointer to the current game board; its dimensions are set from the level
+	@param: name - where the name of the chosen level is stored
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+	
+	@return: 1 - successfully generated a custom game
+			 0 - unsuccessfully generated a custom game
+
+    Precondition: The list of levels is accurate.
+*/
+int generateCustomGame(struct Board *Board, string100 name, int theme) {
+    FILE *fp;
+    string100 directory;
+
+    do {
+        pace(SHORT_SLEEP);
+        clearScreen();
+
+        printf("\n");
+        printDivider();
+
+        printLevels(theme);
+
+        printf("\n");
+        printDivider();
+        printf("\n\n");
+
+        printf(" Enter an existing level to load (or '0' to return to the main menu): ");
+        scanf("%s", name);
+        clearInputBuffer();
+
+        if (strcmp(name, "0") == 0) return 0;
+
+        strcpy(directory, LEVELS_FOLDER);
+        strcat(directory, name);
+        strcat(directory, ".txt");
+
+        fp = fopen(directory, "r");
+        if (fp == NULL) {
+            printf("\n The level '%s' does not exist!", name);
+        }
+    } while (fp == NULL);
+
+    if (!readLevel(Board, fp)) {
+        printf("\n The level '%s' could not be loaded!", name);
+        pace(LONG_SLEEP);
+        fclose(fp);
+        return 0;
+    }
+
+    pace(SHORT_SLEEP);
+    fclose(fp);
+    return 1;
+}
+
+
+/*
+    @brief: initializes the states of the entire board one mine at a time, adding 1 to each of the
+        8 tiles around every mine. Used when the scratch rows of initializeTileStates cannot be
+        allocated or the board is too sparse for them to pay off, and as the reference that
+        initializeTileStates is benchmarked against.
+		  
+	@param: Board - pointer to the current game board
+	
+	Precondition: The mine index contains the locations of all the mines. Every tile's state is 0,
+        or 9 for mines.
+*/
+void initializeTileStatesByMine(struct Board *Board) {
+    int i, j;
+    int index, neighbor;
+    int column;
+    int columns = Board->columns;
+    int numTiles = Board->rows * columns;
+
+    // flat offsets of the neighbors: northwest, north, northeast, west, east, southwest, south, southeast
+    int offsets[8] = {-columns - 1, -columns, -columns + 1, -1, 1, columns - 1, columns, columns + 1};
+    int columnShifts[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+
+    for (i = 0; i < Board->Mines.numMines; i++) {
+        index = Board->Mines.cells[i];
+        column = index % columns;
+
+        for (j = 0; j < 8; j++) {
+            neighbor = index + offsets[j];
+
+            if (neighbor < 0 || neighbor >= numTiles) continue; // above the first or below the last row
+            if (column + columnShifts[j] < 0 || column + columnShifts[j] >= columns) continue; // past a side
+
+            if (Board->states[neighbor] != 9) Board->states[neighbor]++;
+        }
+    }
+}
+
+
+/*
+    @brief: adds up three rows of mine flags column by column (a vertical 1x3 sum)
+
+    @param: sums - where the sums are stored
+    @param: above - mine flags (0/1) of the row above
+    @param: row - mine flags of the row itself
+    @param: below - mine flags of the row below; NULL for the last row
+    @param: columns - number of columns
+
+    Precondition: every flag is 0 or 1, so no sum exceeds 3
+*/
+void sumRowsVertically(unsigned char sums[], unsigned char above[], unsigned char row[],
+    unsigned char below[], int columns) {
+    int j = 0;
+
+#if defined(__AVX2__)
+    for (; below != NULL && j + 32 <= columns; j += 32) {
+        _mm256_storeu_si256((__m256i *) (sums + j), _mm256_add_epi8(_mm256_add_epi8(
+            _mm256_loadu_si256((__m256i *) (above + j)), _mm256_loadu_si256((__m256i *) (row + j))),
+            _mm256_loadu_si256((__m256i *) (below + j))));
+    }
+#elif defined(__SSE2__)
+    for (; below != NULL && j + 16 <= columns; j += 16) {
+        _mm_storeu_si128((__m128i *) (sums + j), _mm_add_epi8(_mm_add_epi8(
+            _mm_loadu_si128((__m128i *) (above + j)), _mm_loadu_si128((__m128i *) (row + j))),
+            _mm_loadu_si128((__m128i *) (below + j))));
+    }
+#endif
+
+    for (; j < columns; j++) {
+        sums[j] = above[j] + row[j] + (below != NULL ? below[j] : 0);
+    }
+}
+
+
+/*
+    @brief: turns the vertical sums around a row into the row's tile states: the horizontal 1x3 sum
+        of the vertical sums is the 3x3 box sum, and removing the tile's own mine leaves the number
+        of nearby mines
+
+    @param: states - where the tile states of the row are stored
+    @param: sums - vertical sums with one 0 of padding on each side (sums[j + 1] is column j)
+    @param: mines - mine flags (0/1) of the row
+    @param: columns - number of columns
+*/
+void countRowNeighbors(unsigned char states[], unsigned char sums[], unsigned char mines[], int columns) {
+    int j = 0;
+
+#if defined(__AVX2__)
+    __m256i ones = _mm256_set1_epi8(1);
+    __m256i nines = _mm256_set1_epi8(9);
+    __m256i boxSum, mine, isMine;
+
+    for (; j + 32 <= columns; j += 32) {
+        boxSum = _mm256_add_epi8(_mm256_add_epi8(_mm256_loadu_si256((__m256i *) (sums + j)),
+            _mm256_loadu_si256((__m256i *) (sums + j + 1))), _mm256_loadu_si256((__m256i *) (sums + j + 2)));
+        mine = _mm256_loadu_si256((__m256i *) (mines + j));
+        isMine = _mm256_cmpeq_epi8(mine, ones);
+
+        _mm256_storeu_si256((__m256i *) (states + j), _mm256_blendv_epi8(_mm256_sub_epi8(boxSum, mine),
+            nines, isMine));
+    }
+#elif defined(__SSE2__)
+    __m128i ones = _mm_set1_epi8(1);
+    __m128i nines = _mm_set1_epi8(9);
+    __m128i boxSum, mine, isMine;
+
+    for (; j + 16 <= columns; j += 16) {
+        boxSum = _mm_add_epi8(_mm_add_epi8(_mm_loadu_si128((__m128i *) (sums + j)),
+            _mm_loadu_si128((__m128i *) (sums + j + 1))), _mm_loadu_si128((__m128i *) (sums + j + 2)));
+        mine = _mm_loadu_si128((__m128i *) (mines + j));
+        isMine = _mm_cmpeq_epi8(mine, ones);
+
+        _mm_storeu_si128((__m128i *) (states + j), _mm_or_si128(_mm_and_si128(isMine, nines),
+            _mm_andnot_si128(isMine, _mm_sub_epi8(boxSum, mine))));
+    }
+#endif
+
+    for (; j < columns; j++) {
+        states[j] = mines[j] ? 9 : sums[j] + sums[j + 1] + sums[j + 2] - mines[j];
+    }
+}
+
+
+/*
+    @brief: initializes the states of the entire board based on the locations of all the mines.
+        Every tile's count is the sum of the 3x3 box of mine flags around it, minus its own flag;
+        the box sums are computed a row at a time with SSE2/AVX2 when the compiler targets them
+        and with plain loops otherwise, and the result is identical either way.
+		  
+	@param: Board - pointer to the current game board
+	
+	Precondition: The mine index contains the locations of all the mines. Every tile's state is 0,
+        or 9 for mines.
+*/
+void initializeTileStates(struct Board *Board) {
+    int i;
+    int columns = Board->columns;
+    unsigned char *row, *below;
+    unsigned char *above, *flags, *sums;
+    unsigned char *newBuffer;
+    unsigned char *temp;
+
+    // on very sparse boards, visiting the few mines is cheaper than summing every tile
+    if (Board->Mines.numMines * 64 < Board->rows * columns) {
+        initializeTileStatesByMine(Board);
+        return;
+    }
+
+    // two rows of mine flags (the row above and the current row) and a padded row of sums
+    if (Board->rowCapacity < 3 * columns + 2) {
+        newBuffer = realloc(Board->rowBuffer, 3 * columns + 2);
+
+        if (newBuffer == NULL) {
+            initializeTileStatesByMine(Board);
+            return;
+        }
+
+        Board->rowBuffer = newBuffer;
+        Board->rowCapacity = 3 * columns + 2;
+    }
+
+    above = Board->rowBuffer;
+    flags = Board->rowBuffer + columns;
+    sums = Board->rowBuffer + 2 * columns;
+
+    // turn the states into mine flags; each row is overwritten by its counts once it has been summed,
+    // so its flags are copied out first and serve as the row above of the next row
+    for (i = 0; i < Board->Mines.numMines; i++) {
+        Board->states[Board->Mines.cells[i]] = 1;
+    }
+
+    memset(above, 0, columns);
+    sums[0] = 0;
+    sums[columns + 1] = 0;
+
+    for (i = 0; i < Board->rows; i++) {
+        row = Board->states + i * columns;
+        below = i < Board->rows - 1 ? row + columns : NULL;
+
+        sumRowsVertically(sums + 1, above, row, below, columns);
+        memcpy(flags, row, columns);
+        countRowNeighbors(row, sums, flags, columns);
+
+        temp = above;
+        above = flags;
+        flags = temp;
+    }
+}
+
+
+/*
+    @brief: determines what a tile shows on the screen
+
+    @param: Board - pointer to the game board
+    @param: row - the row of the tile
+    @param: column - the column of the tile
+
+    @return: the tile's state (0 - 10) if it is revealed; GLYPH_FLAG if it is flagged; otherwise,
+        GLYPH_HIDDEN
+*/
+int getTileGlyph(struct Board *Board, int row, int column) {
+    if (isTileRevealed(Board, row, column)) return getTileState(Board, row, column);
+    if (isTileFlagged(Board, row, column)) return GLYPH_FLAG;
+    return GLYPH_HIDDEN;
+}
+
+
+/*
+    @brief: initializes an empty screen buffer
+
+    @param: Buffer - pointer to the buffer
+*/
+void initializeScreenBuffer(struct ScreenBuffer *Buffer) {
+    Buffer->bytes = NULL;
+    Buffer->length = 0;
+    Buffer->capacity = 0;
+    Buffer->hasFailed = 0;
+}
+
+
+/*
+    @brief: frees the bytes of a screen buffer and leaves it empty
+
+    @param: Buffer - pointer to the buffer
+*/
+void freeScreenBuffer(struct ScreenBuffer *Buffer) {
+    free(Buffer->bytes);
+    initializeScreenBuffer(Buffer);
+}
+
+
+/*
+    @brief: appends bytes to a screen buffer, doubling it when they do not fit
+
+    @param: Buffer - pointer to the buffer
+    @param: bytes - the bytes
+    @param: length - number of bytes
+*/
+void appendBytes(struct ScreenBuffer *Buffer, char bytes[], int length) {
+    int newCapacity;
+    char *newBytes;
+
+    if (Buffer->length + length > Buffer->capacity) {
+        newCapacity = Buffer->capacity == 0 ? 64 : Buffer->capacity;
+        while (newCapacity < Buffer->length + length) newCapacity *= 2;
+
+        newBytes = realloc(Buffer->bytes, newCapacity);
+
+        if (newBytes == NULL) {
+            Buffer->hasFailed = 1;
+            return;
+        }
+
+        Buffer->bytes = newBytes;
+        Buffer->capacity = newCapacity;
+    }
+
+    memcpy(Buffer->bytes + Buffer->length, bytes, length);
+    Buffer->length += length;
+}
+
+
+/*
+    @brief: appends a string to a screen buffer
+
+    @param: Buffer - pointer to the buffer
+    @param: text - the string
+*/
+void appendText(struct ScreenBuffer *Buffer, char text[]) {
+    appendBytes(Buffer, text, strlen(text));
+}
+
+
+/*
+    @brief: appends a single character to a screen buffer; characters from 128 to 255 are the
+        console's box-drawing and block characters
+
+    @param: Buffer - pointer to the buffer
+    @param: character - the character's code
+*/
+void appendCharacter(struct ScreenBuffer *Buffer, int character) {
+    char byte = (char) character;
+
+    appendBytes(Buffer, &byte, 1);
+}
+
+
+/*
+    @brief: appends a non-negative number padded with spaces, like printf's "%<width>d" or, for a
+        negative width, "%-<width>d"
+
+    @param: Buffer - pointer to the buffer
+    @param: number - the number; at least 0
+    @param: width - least number of characters; negative to pad on the right instead of the left
+*/
+void appendNumber(struct ScreenBuffer *Buffer, int number, int width) {
+    char digits[12];
+    int numDigits = 0;
+    int padding;
+
+    do {
+        digits[11 - numDigits++] = '0' + number % 10;
+        number /= 10;
+    } while (number > 0);
+
+    padding = (width < 0 ? -width : width) - numDigits;
+
+    while (width > 0 && padding-- > 0) appendCharacter(Buffer, ' ');
+    appendBytes(Buffer, digits + 12 - numDigits, numDigits);
+    while (width < 0 && padding-- > 0) appendCharacter(Buffer, ' ');
+}
+
+
+/*
+    @brief: writes a screen buffer to the console with a single write, after anything already
+        printed, and empties it
+
+    @param: Buffer - pointer to the buffer
+*/
+void writeScreenBuffer(struct ScreenBuffer *Buffer) {
+    fflush(stdout);
+    if (Buffer->length > 0) writeConsole(Buffer->bytes, Buffer->length);
+
+    Buffer->length = 0;
+    Buffer->hasFailed = 0;
+}
+
+
+/*
+    @brief: appends what a tile shows, in a single character
+
+    @param: Buffer - pointer to the buffer
+    @param: glyph - the tile's glyph (see getTileGlyph)
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void appendGlyph(struct ScreenBuffer *Buffer, int glyph, int theme) {
+    if (glyph == 0) { // empty; no nearby mines
+        appendText(Buffer, " ");
+    }
+    else if (glyph >= 1 && glyph <= 8) { // 1 - 8 nearby mines
+        appendText(Buffer, "\x1b[1m\x1b[37m");
+        appendCharacter(Buffer, '0' + glyph);
+        appendText(Buffer, "\x1b[0m");
+    }
+    else if (glyph == 9) { // mine
+        appendText(Buffer, "\x1b[1m\x1b[31m\xe9\x1b[0m");
+    }
+    else if (glyph == 10) { // exploded mine
+        appendText(Buffer, "\x1b[1m\x1b[31m\xfe\x1b[0m");
+    }
+    else if (glyph == GLYPH_FLAG) { // tile is flagged
+        appendText(Buffer, "\x1b[1m\x1b[37m\xdb\x1b[0m");
+    }
+    else { // tile is not yet inspected
+		if (theme == 1) { // cyan
+        	appendText(Buffer, "\x1b[1m\x1b[36m\xdb\x1b[0m");
+    	}
+    	else if (theme == 2) { // bright red
+    		appendText(Buffer, "\x1b[1m\x1b[31m\xdb\x1b[0m");
+		}
+		else if (theme == 3) { // bright green
+			appendText(Buffer, "\x1b[1m\x1b[32m\xdb\x1b[0m");
+		}
+        else if (theme == 4) { // dark purple
+            appendText(Buffer, "\x1b[1m\x1b[35m\xdb\x1b[0m");
+        }
+    }
+}
+
+
+/*
+    @brief: appends a horizontal border of the board, e.g. " +---+---+"
+
+    @param: Buffer - pointer to the buffer
+    @param: columns - number of columns of the board
+    @param: labelWidth - characters of the row numbers, which the border is indented past
+    @param: left - the character of the left corner or edge
+    @param: middle - the character where the border meets a vertical line
+    @param: right - the character of the right corner or edge
+*/
+void appendBorder(struct ScreenBuffer *Buffer, int columns, int labelWidth, int left, int middle, int right) {
+    int i;
+
+    appendText(Buffer, " \x1b[1m\x1b[30m");
+    for (i = 0; i < labelWidth; i++)
+        appendCharacter(Buffer, ' ');
+    appendCharacter(Buffer, left);
+    appendText(Buffer, "\xc4\xc4\xc4\x1b[0m");
+
+    for (i = 0; i < columns - 1; i++) {
+        appendText(Buffer, "\x1b[1m\x1b[30m");
+        appendCharacter(Buffer, middle);
+        appendText(Buffer, "\xc4\xc4\xc4\x1b[0m");
+    }
+
+    appendText(Buffer, "\x1b[1m\x1b[30m");
+    appendCharacter(Buffer, right);
+    appendText(Buffer, "\x1b[0m\n");
+}
+
+
+/*
+    @brief: appends the cursor's marker on one side of a tile, or a space if the cursor is elsewhere
+
+    @param: Buffer - pointer to the buffer
+    @param: isCursor - 1 if the cursor is on the tile
+    @param: marker - '>' on the left of the tile, '<' on the right
+*/
+void appendMarker(struct ScreenBuffer *Buffer, int isCursor, char marker) {
+    if (isCursor) {
+        appendText(Buffer, "\x1b[1m\x1b[37m");
+        appendCharacter(Buffer, marker);
+        appendText(Buffer, "\x1b[0m");
+    }
+    else {
+        appendText(Buffer, " ");
+    }
+}
+
+
+/*
+    @brief: appends an escape that places the console's cursor on a line and column of the screen
+
+    @param: Buffer - pointer to the buffer
+    @param: line - the line, counted from 1 at the top of the screen
+    @param: column - the column, counted from 1 at the left of the screen
+*/
+void appendPosition(struct ScreenBuffer *Buffer, int line, int column) {
+    appendText(Buffer, "\x1b[");
+    appendNumber(Buffer, line, 0);
+    appendText(Buffer, ";");
+    appendNumber(Buffer, column, 0);
+    appendText(Buffer, "H");
+}
+
+
+/*
+    @brief: fits the window of a board to the console, then scrolls it as little as needed to keep
+        the cursor inside it and the board's edges outside it
+
+    @param: View - pointer to the window; its origin and isDense are kept from the last frame
+    @param: Board - pointer to the game board
+    @param: screenRows - lines of the console; 0 if unknown, which shows the whole board
+    @param: screenColumns - characters per line of the console
+    @param: numTextLines - lines of the screen taken by everything but the board
+    @param: currRow - the row of the cursor; -1 for no cursor
+    @param: currColumn - the column of the cursor; -1 for no cursor
+*/
+void fitViewport(struct Viewport *View, struct Board *Board, int screenRows, int screenColumns,
+    int numTextLines, int currRow, int currColumn) {
+    int maxRows, maxColumns;
+    int number;
+
+    View->labelWidth = 3;
+    for (number = Board->rows; number >= 1000; number /= 10)
+        View->labelWidth++;
+
+    View->rows = Board->rows;
+    View->columns = Board->columns;
+
+    if (screenRows > 0) {
+        if (View->isDense) { // " 12  ..x.." under a line of column numbers
+            maxRows = screenRows - numTextLines - 3;
+            maxColumns = screenColumns - View->labelWidth - 2;
+        }
+        else { // " 12 | x |", two lines a row, under the column numbers and the upper border
+            maxRows = (screenRows - numTextLines - 4) / 2;
+            maxColumns = (screenColumns - View->labelWidth - 2) / 4;
+        }
+
+        if (View->rows > maxRows) View->rows = maxRows > 1 ? maxRows : 1;
+        if (View->columns > maxColumns) View->columns = maxColumns > 1 ? maxColumns : 1;
+    }
+
+    if (currRow >= 0) {
+        if (currRow < View->originRow) View->originRow = currRow;
+        if (currRow >= View->originRow + View->rows) View->originRow = currRow - View->rows + 1;
+    }
+
+    if (currColumn >= 0) {
+        if (currColumn < View->originColumn) View->originColumn = currColumn;
+        if (currColumn >= View->originColumn + View->columns) View->originColumn = currColumn - View->columns + 1;
+    }
+
+    if (View->originRow > Board->rows - View->rows) View->originRow = Board->rows - View->rows;
+    if (View->originRow < 0) View->originRow = 0;
+    if (View->originColumn > Board->columns - View->columns) View->originColumn = Board->columns - View->columns;
+    if (View->originColumn < 0) View->originColumn = 0;
+}
+
+
+/*
+    @brief: appends the line of column numbers above a window. The bordered board numbers every
+        column; the dense board numbers its first column and every tenth column where they fit.
+
+    @param: Buffer - pointer to the buffer
+    @param: View - pointer to the window
+*/
+void appendColumnNumbers(struct ScreenBuffer *Buffer, struct Viewport *View) {
+    int j, column;
+    int numDigits, number;
+    int nextFree = 0; // first column of the window not covered by a number yet
+
+    if (!View->isDense) {
+        appendNumber(Buffer, View->originColumn + 1, View->labelWidth + 4);
+        for (j = 1; j < View->columns; j++)
+            appendNumber(Buffer, View->originColumn + j + 1, 4);
+        return;
+    }
+
+    for (j = 0; j < View->labelWidth + 2; j++)
+        appendCharacter(Buffer, ' ');
+
+    for (j = 0; j < View->columns; j++) {
+        column = View->originColumn + j;
+
+        numDigits = 1;
+        for (number = column + 1; number >= 10; number /= 10)
+            numDigits++;
+
+        if ((j == 0 || column % 10 == 0) && j >= nextFree && j + numDigits <= View->columns) {
+            appendNumber(Buffer, column + 1, 0);
+            nextFree = j + numDigits + 1;
+        }
+        else if (j >= nextFree) {
+            appendCharacter(Buffer, ' ');
+        }
+    }
+}
+
+
+/*
+    @brief: composes the text of every tile in the glyph table, for every theme and way of drawing
+        it, from appendGlyph and appendMarker. Only the first call does anything.
+
+    @return: 1 - the table is ready
+             0 - not enough memory to compose the table
+*/
+int prepareGlyphTable() {
+    struct ScreenBuffer Buffer;
+    int theme, style, code;
+    int glyph, isCursor;
+
+    if (Glyphs.isReady) return 1;
+
+    initializeScreenBuffer(&Buffer);
+
+    for (theme = 1; theme <= NUM_THEMES; theme++) {
+        for (style = 0; style < NUM_TILE_STYLES; style++) {
+            for (code = 0; code < NUM_TILE_CODES; code++) {
+                glyph = code % FRAME_CURSOR;
+                isCursor = code >= FRAME_CURSOR;
+                Buffer.length = 0;
+
+                if (style == TILE_DENSE) {
+                    if (isCursor) appendText(&Buffer, "\x1b[7m");
+                    appendGlyph(&Buffer, glyph, theme);
+                    if (isCursor) appendText(&Buffer, "\x1b[0m");
+                }
+                else {
+                    if (style == TILE_BORDERED) appendText(&Buffer, "\x1b[1m\x1b[30m\xb3\x1b[0m");
+                    appendMarker(&Buffer, isCursor, '>');
+
+                    if (style == TILE_MARKERS) appendText(&Buffer, "\x1b[C");
+                    else appendGlyph(&Buffer, glyph, theme);
+
+                    appendMarker(&Buffer, isCursor, '<');
+                }
+
+                if (Buffer.hasFailed || Buffer.length > TILE_TEXT_SIZE) {
+                    freeScreenBuffer(&Buffer);
+                    return 0;
+                }
+
+                memcpy(Glyphs.text[theme - 1][style][code], Buffer.bytes, Buffer.length);
+                Glyphs.length[theme - 1][style][code] = Buffer.length;
+            }
+        }
+    }
+
+    freeScreenBuffer(&Buffer);
+    Glyphs.isReady = 1;
+    return 1;
+}
+
+
+/*
+    @brief: appends a tile's text from the glyph table
+
+    @param: Buffer - pointer to the buffer
+    @param: style - the way the tile is drawn (TILE_BORDERED, TILE_BORDERLESS, TILE_MARKERS, or TILE_DENSE)
+    @param: code - the tile's glyph (see getTileGlyph), plus FRAME_CURSOR if the cursor is on it
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: the glyph table is ready, and theme is from 1 to 4.
+*/
+void appendTile(struct ScreenBuffer *Buffer, int style, int code, int theme) {
+    appendBytes(Buffer, Glyphs.text[theme - 1][style][code], Glyphs.length[theme - 1][style][code]);
+}
+
+
+/*
+    @brief: appends the window of a game board given information about it
+
+    @param: Buffer - pointer to the buffer
+	@param: Board - pointer to the game board being printed
+    @param: View - pointer to the window of the board to append (see fitViewport)
+	@param: currRow - indicates the row of the cursor ( > < )
+	@param: currColumn - indicates the column of the cursor ( > < )
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: currRow and currColumn are positive and within range if the user's cursor is to
+        be printed. The glyph table is ready.
+*/
+void appendBoard(struct ScreenBuffer *Buffer, struct Board *Board, struct Viewport *View, int currRow,
+    int currColumn, int theme) {
+    int i, j;
+    int row, column;
+    int code;
+
+    // the column numbers
+    appendText(Buffer, "\n");
+    appendColumnNumbers(Buffer, View);
+    appendText(Buffer, "\n");
+
+    if (!View->isDense) {
+        appendBorder(Buffer, View->columns, View->labelWidth, 218, 194, 191); // the upper border
+    }
+
+    // the body
+    for (i = 0; i < View->rows; i++) {
+        row = View->originRow + i;
+
+        appendText(Buffer, " ");
+        appendNumber(Buffer, row + 1, -View->labelWidth);
+        if (View->isDense) appendText(Buffer, " ");
+
+        for (j = 0; j < View->columns; j++) {
+            column = View->originColumn + j;
+            code = getTileGlyph(Board, row, column) + (row == currRow && column == currColumn ? FRAME_CURSOR : 0);
+            appendTile(Buffer, View->isDense ? TILE_DENSE : TILE_BORDERED, code, theme);
+        }
+
+        if (View->isDense) {
+            appendText(Buffer, "\n");
+            continue;
+        }
+
+        appendText(Buffer, "\x1b[1m\x1b[30m\xb3\x1b[0m\n");
+
+        if (i < View->rows - 1) {
+            appendBorder(Buffer, View->columns, View->labelWidth, 195, 197, 180); // the middle border
+        }
+    }
+
+    if (!View->isDense) {
+        appendBorder(Buffer, View->columns, View->labelWidth, 192, 193, 217); // the lower border
+    }
+}
+
+
+/*
+    @brief: prints a whole game board given information about it, composed first and written at
+        once. The buffer it is composed in grows to the largest board printed and is then reused,
+        so printing allocates nothing after the first board.
+
+	@param: Board - pointer to the game board being printed
+	@param: currRow - indicates the row of the cursor ( > < )
+	@param: currColumn - indicates the column of the cursor ( > < )
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: currRow and currColumn are positive and within range if the user's cursor is to
+        be printed.
+*/
+void printBoard(struct Board *Board, int currRow, int currColumn, int theme) {
+    static struct ScreenBuffer Buffer = {NULL, 0, 0, 0}; // kept between calls; emptied by each write
+    struct Viewport View = {0, 0, 0, 0, 0, 0};
+
+    if (!prepareGlyphTable()) return;
+    fitViewport(&View, Board, 0, 0, 0, -1, -1);
+
+    appendBoard(&Buffer, Board, &View, currRow, currColumn, theme);
+    writeScreenBuffer(&Buffer);
+}
+
+
+/*
+    @brief: initializes a frame that has not been drawn yet, fitted to the console and drawn the
+        way the program's options say
+
+    @param: Frame - pointer to the frame
+*/
+void initializeFrame(struct Frame *Frame) {
+    struct Viewport View = {0, 0, 0, 0, 0, 0};
+
+    Frame->cells = NULL;
+    Frame->capacity = 0;
+    Frame->rows = 0;
+    Frame->columns = 0;
+    Frame->theme = 0;
+    Frame->isDrawn = 0;
+    strcpy(Frame->header, "");
+    strcpy(Frame->footer, "");
+
+    View.isDense = isDenseBoard;
+    Frame->View = View;
+    Frame->screenRows = 0;
+    Frame->screenColumns = 0;
+
+    initializeScreenBuffer(&Frame->Buffer);
+    Frame->frameBytes = 0;
+    Frame->buildMicroseconds = 0;
+}
+
+
+/*
+    @brief: frees the buffer of a frame and leaves it undrawn
+
+    @param: Frame - pointer to the frame
+*/
+void freeFrame(struct Frame *Frame) {
+    free(Frame->cells);
+    freeScreenBuffer(&Frame->Buffer);
+    initializeFrame(Frame);
+}
+
+
+/*
+    @brief: counts the lines a text moves the console's cursor down by
+
+    @param: text - the text
+
+    @return: the number of newlines in the text
+*/
+int countLines(char text[]) {
+    int numLines = 0;
+    int i;
+
+    for (i = 0; text[i] != '\0'; i++) {
+        numLines += text[i] == '\n';
+    }
+
+    return numLines;
+}
+
+
+/*
+    @brief: composes the next frame in the frame's buffer, changing as little of the screen as
+        possible. Only the window of the board that fits on the console is drawn, and it scrolls
+        to keep the cursor inside it, so a frame costs as much as the console is large however
+        large the board is. If the frame was drawn before with the same window size, theme, and
+        text, only the tiles that changed are rewritten, each after an escape that places the
+        console's cursor on it, so moving the cursor rewrites two tiles instead of the whole
+        screen; scrolling rewrites the row or column numbers too. Otherwise, the frame clears the
+        screen and holds the title, the window, and the text around it, so that even a frame drawn
+        in full is a single write. The frame's size and the
+        time taken to compose it are kept in the frame.
+
+    @param: Frame - pointer to the frame last drawn
+    @param: Board - pointer to the game board
+    @param: currRow - the row of the cursor ( > < ); -1 for no cursor
+    @param: currColumn - the column of the cursor ( > < ); -1 for no cursor
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @param: header - text printed between the title and the board
+    @param: footer - text printed under the board; the console's cursor is left at its end
+
+    @return: 1 - the frame clears the screen and draws everything again
+             0 - the frame only changes what is on the screen
+
+    Precondition: nothing else was printed since the frame was drawn unless its isDrawn was reset
+*/
+int buildFrame(struct Frame *Frame, struct Board *Board, int currRow, int currColumn, int theme,
+    char header[], char footer[]) {
+    struct ScreenBuffer *Buffer = &Frame->Buffer;
+    struct Viewport View = Frame->View;
+    int labelLine = EVADE_LINES + countLines(header) + 2; // screen line of the column numbers
+    int firstLine; // screen line of the first row of tiles
+    int lineStep; // screen lines from one row of tiles to the next
+    int screenRows = Frame->screenRows;
+    int screenColumns = Frame->screenColumns;
+    int numTiles;
+    int isFull;
+    int isChanged = 0;
+    int glyph, index;
+    int row, column;
+    int i, j;
+    long long startTime = getMicroseconds();
+    unsigned char *newCells;
+    char title[EVADE_TEXT_SIZE];
+
+    Buffer->length = 0;
+    if (!prepareGlyphTable()) Buffer->hasFailed = 1; // the tiles are left out; the next frame tries again
+
+    if (screenRows == 0 && !getConsoleSize(&screenRows, &screenColumns)) {
+        screenRows = 0; // not a console; the whole board is drawn
+    }
+
+    fitViewport(&View, Board, screenRows, screenColumns, EVADE_LINES + countLines(header) + countLines(footer),
+        currRow, currColumn);
+
+    numTiles = View.rows * View.columns;
+    firstLine = labelLine + (View.isDense ? 1 : 2);
+    lineStep = View.isDense ? 1 : 2;
+
+    if (Frame->isDrawn && (Frame->rows != Board->rows || Frame->columns != Board->columns ||
+        Frame->View.rows != View.rows || Frame->View.columns != View.columns ||
+        Frame->theme != theme || strcmp(Frame->header, header) != 0 || strcmp(Frame->footer, footer) != 0)) {
+        Frame->isDrawn = 0;
+    }
+
+    isFull = !Frame->isDrawn;
+
+    if (isFull) {
+        appendText(Buffer, CLEAR_SEQUENCE);
+        appendBytes(Buffer, title, composeEvade(title, theme));
+        appendText(Buffer, header);
+        appendBoard(Buffer, Board, &View, currRow, currColumn, theme);
+        appendText(Buffer, footer);
+        appendText(Buffer, "\x1b" "7"); // remember where the footer ends
+
+        Frame->isDrawn = strlen(header) < FRAME_TEXT_SIZE && strlen(footer) < FRAME_TEXT_SIZE;
+
+        if (Frame->capacity < numTiles) {
+            newCells = realloc(Frame->cells, numTiles);
+
+            if (newCells == NULL) {
+                Frame->isDrawn = 0; // the next frame is drawn in full again
+            }
+            else {
+                Frame->cells = newCells;
+                Frame->capacity = numTiles;
+            }
+        }
+
+        if (Frame->isDrawn) {
+            for (i = 0; i < View.rows; i++) {
+                for (j = 0; j < View.columns; j++) {
+                    row = View.originRow + i;
+                    column = View.originColumn + j;
+
+                    Frame->cells[i * View.columns + j] = getTileGlyph(Board, row, column) +
+                        (row == currRow && column == currColumn ? FRAME_CURSOR : 0);
+                }
+            }
+
+            Frame->rows = Board->rows;
+            Frame->columns = Board->columns;
+            Frame->theme = theme;
+            strcpy(Frame->header, header);
+            strcpy(Frame->footer, footer);
+        }
+    }
+    else {
+        if (View.originColumn != Frame->View.originColumn) { // scrolled sideways
+            appendPosition(Buffer, labelLine, 1);
+            appendColumnNumbers(Buffer, &View);
+            appendText(Buffer, "\x1b[K"); // a shorter line of numbers leaves nothing behind
+            isChanged = 1;
+        }
+
+        for (i = 0; i < View.rows; i++) {
+            row = View.originRow + i;
+
+            if (View.originRow != Frame->View.originRow) { // scrolled up or down
+                appendPosition(Buffer, firstLine + lineStep * i, 2);
+                appendNumber(Buffer, row + 1, -View.labelWidth);
+                isChanged = 1;
+            }
+
+            for (j = 0; j < View.columns; j++) {
+                column = View.originColumn + j;
+                index = i * View.columns + j;
+                glyph = getTileGlyph(Board, row, column) + (row == currRow && column == currColumn ? FRAME_CURSOR : 0);
+
+                if (glyph == Frame->cells[index]) continue;
+
+                if (View.isDense) { // a tile is a single character after the row number
+                    appendPosition(Buffer, firstLine + i, View.labelWidth + 3 + j);
+                    appendTile(Buffer, TILE_DENSE, glyph, theme);
+                }
+                else { // a tile is "|>x<" on the screen; the border is never redrawn
+                    appendPosition(Buffer, firstLine + 2 * i, View.labelWidth + 3 + 4 * j);
+                    appendTile(Buffer, glyph % FRAME_CURSOR != Frame->cells[index] % FRAME_CURSOR ?
+                        TILE_BORDERLESS : TILE_MARKERS, glyph, theme);
+                }
+
+                Frame->cells[index] = glyph;
+                isChanged = 1;
+            }
+        }
+
+        if (isChanged) {
+            appendText(Buffer, "\x1b" "8"); // back to the end of the footer
+        }
+    }
+
+    Frame->View = View;
+
+    if (Buffer->hasFailed) Frame->isDrawn = 0; // part of the frame is missing; the next one is drawn in full
+
+    Frame->frameBytes = Buffer->length;
+    Frame->buildMicroseconds = getMicroseconds() - startTime;
+    return isFull;
+}
+
+
+/*
+    @brief: finds the bucket of a latency in a histogram
+
+    @param: microseconds - the latency
+
+    @return: the index of the bucket
+*/
+int getLatencyBucket(long long microseconds) {
+    int exponent, bucket;
+
+    if (microseconds < LATENCY_EXACT) return microseconds < 0 ? 0 : microseconds;
+
+    exponent = 63 - __builtin_clzll(microseconds); // at least log2(LATENCY_EXACT), which is 4
+    bucket = LATENCY_EXACT + (exponent - 4) * LATENCY_STEPS + (microseconds >> (exponent - 3)) - LATENCY_STEPS;
+
+    return bucket < NUM_LATENCY_BUCKETS ? bucket : NUM_LATENCY_BUCKETS - 1;
+}
+
+
+/*
+    @brief: finds the largest latency that falls in a bucket of a histogram
+
+    @param: bucket - the index of the bucket
+
+    @return: the latency, in microseconds
+*/
+long long getLatencyBucketEnd(int bucket) {
+    int exponent, step;
+
+    if (bucket < LATENCY_EXACT) return bucket;
+
+    exponent = (bucket - LATENCY_EXACT) / LATENCY_STEPS + 4;
+    step = (bucket - LATENCY_EXACT) % LATENCY_STEPS;
+
+    return ((long long) (LATENCY_STEPS + step + 1) << (exponent - 3)) - 1;
+}
+
+
+/*
+    @brief: reads a percentile of the latencies of a histogram
+
+    @param: Histogram - pointer to the histogram
+    @param: fraction - the percentile, as a fraction of the inputs (e.g., 0.99 for p99)
+
+    @return: the latency in microseconds that at least that fraction of the inputs were answered
+             in, rounded up to the end of its bucket but never past the largest latency
+*/
+long long getLatencyPercentile(struct LatencyHistogram *Histogram, double fraction) {
+    long long rank = (long long) ceil(fraction * Histogram->numInputs);
+    long long seen = 0;
+    int i;
+
+    for (i = 0; i < NUM_LATENCY_BUCKETS; i++) {
+        seen += Histogram->counts[i];
+        if (seen >= rank && seen > 0) break;
+    }
+
+    if (i == NUM_LATENCY_BUCKETS || getLatencyBucketEnd(i) > Histogram->maxMicroseconds) {
+        return Histogram->maxMicroseconds;
+    }
+    return getLatencyBucketEnd(i);
+}
+
+
+/*
+    @brief: notes that an input was read on a screen; the frame drawn next is its answer
+
+    @param: screen - one of the LATENCY_ screens
+*/
+void markInput(int screen) {
+    Latency.inputMicroseconds = getMicroseconds();
+    Latency.inputScreen = screen;
+}
+
+
+/*
+    @brief: notes that a frame was drawn, counting the latency of the input it answers, if any
+*/
+void markFrame() {
+    struct LatencyHistogram *Histogram;
+    long long latency;
+
+    if (Latency.inputMicroseconds == 0) return; // the frame was not drawn for an input
+
+    latency = getMicroseconds() - Latency.inputMicroseconds;
+    Latency.inputMicroseconds = 0;
+
+    Histogram = &Latency.Screens[Latency.inputScreen];
+    Histogram->counts[getLatencyBucket(latency)]++;
+    Histogram->numInputs++;
+    Histogram->totalMicroseconds += latency;
+    if (latency > Histogram->maxMicroseconds) Histogram->maxMicroseconds = latency;
+}
+
+
+/*
+    @brief: prints the percentiles of the latencies from input to frame of every screen that had
+        inputs
+*/
+void printLatencyReport() {
+    char *names[NUM_LATENCY_SCREENS] = {"Game board", "Game actions", "Endless board", "Endless actions"};
+    struct LatencyHistogram *Histogram;
+    int i, hasInputs = 0;
+
+    printf(" Input-to-frame latency, in microseconds:\n\n");
+    printf(" %-16s %8s %8s %8s %8s %8s %8s\n", "Screen", "Inputs", "Mean", "p50", "p90", "p99", "Max");
+
+    for (i = 0; i < NUM_LATENCY_SCREENS; i++) {
+        Histogram = &Latency.Screens[i];
+        if (Histogram->numInputs == 0) continue;
+
+        printf(" %-16s %8lld %8lld %8lld %8lld %8lld %8lld\n", names[i], Histogram->numInputs,
+            Histogram->totalMicroseconds / Histogram->numInputs, getLatencyPercentile(Histogram, 0.5),
+            getLatencyPercentile(Histogram, 0.9), getLatencyPercentile(Histogram, 0.99),
+            Histogram->maxMicroseconds);
+        hasInputs = 1;
+    }
+
+    if (!hasInputs) printf(" No frames have been drawn for an input yet.\n");
+}
+
+
+/*
+    @brief: draws the title, a board with the cursor, and the text above and below it, composing
+        the frame first (see buildFrame) and writing it to the console with a single write
+
+    @param: Frame - pointer to the frame last drawn
+    @param: Board - pointer to the game board
+    @param: currRow - the row of the cursor ( > < ); -1 for no cursor
+    @param: currColumn - the column of the cursor ( > < ); -1 for no cursor
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @param: header - text printed between the title and the board
+    @param: footer - text printed under the board; the console's cursor is left at its end
+
+    @return: 1 - the screen was cleared and the frame drawn in full
+             0 - the frame only changed what was on the screen, or nothing is drawn
+
+    Precondition: nothing else was printed since the frame was drawn unless its isDrawn was reset
+*/
+int renderFrame(struct Frame *Frame, struct Board *Board, int currRow, int currColumn, int theme,
+    char header[], char footer[]) {
+    int isFull;
+
+    if (isBatch) return 0; // nothing is drawn, so the frames are not composed either
+
+    isFull = buildFrame(Frame, Board, currRow, currColumn, theme, header, footer);
+    writeScreenBuffer(&Frame->Buffer);
+    markFrame();
+
+    return isFull;
+}
+
+
+/*
+    @brief: detects key presses, allowing the user to utilize keys to navigate through the board
+	
+	@param: currRow - pointer to the current row position of the cursor ( > < )
+	@param: currColumn - pointer to the current column position of the cursor ( > < )
+	@param: rows - number of rows of the board, also serves as a limit for out of bounds cursor
+	@param: columns - number of columns of the board, also serves as a limit for out of bounds cursor
+	
+	@return: the ASCII value of the pressed key
+*/
+int detectKeyPress(int *currRow, int *currColumn, int rows, int columns) {
+    int key = readKey();
+
+    if (key == ARROW_VALUE) { // arrow key press
+        key = readKey();
+
+        if (key == UP_VALUE) { // up arrow key
+            if (*currRow != 0) {
+                (*currRow)--;
+            }
+        }
+        else if (key == DOWN_VALUE) { // down arrow key
+            if (*currRow != rows - 1) {
+                (*currRow)++;
+            }
+        }
+        else if (key == LEFT_VALUE) { // left arrow key
+            if (*currColumn != 0) {
+                (*currColumn)--;
+            }
+        }
+        else if (key == RIGHT_VALUE) { // right arrow key
+            if (*currColumn != columns - 1) {
+                (*currColumn)++;
+            }
+        }
+    }
+
+    return key;
+}
+
+
+/*
+    @brief: reveals a tile; continues revealing tiles adjacent to it if it is a blank. This is the
+        original recursive version, kept as the reference for benchmarkReveal.
+	
+	@param: Board - pointer to the current game board
+	@param: row - the row of the tile inspected
+	@param: column - the column of the tile inspected
+	
+	Precondition: The board information is accurate. The blank region is small enough for the
+        recursion to fit on the call stack.
+*/
+void revealTilesRecursive(struct Board *Board, int row, int column) {
+    int validRow = row >= 0 && row <= Board->rows - 1;
+    int validColumn = column >= 0 && column <= Board->columns - 1;
+
+    if (!validRow || !validColumn) return;
+    if (isTileRevealed(Board, row, column)) return;
+    setTileRevealed(Board, row, column, 1);
+    if (getTileState(Board, row, column) != 0) return;
+
+    // at this point, the tile is confirmed to be an unrevealed blank, triggering the cascading
+    revealTilesRecursive(Board, row - 1, column - 1); // tile northwest
+    revealTilesRecursive(Board, row - 1, column); // tile north
+    revealTilesRecursive(Board, row - 1, column + 1); // tile northeast
+    revealTilesRecursive(Board, row, column - 1); // tile west
+    revealTilesRecursive(Board, row, column + 1); // tile east
+    revealTilesRecursive(Board, row + 1, column - 1); // tile southwest
+    revealTilesRecursive(Board, row + 1, column); // tile south
+    revealTilesRecursive(Board, row + 1, column + 1); // tile southeast
+}
+
+
+/*
+    @brief: initializes an empty undo history
+
+    @param: History - pointer to the history
+*/
+void initializeUndoHistory(struct UndoHistory *History) {
+    History->tiles = NULL;
+    History->numTiles = 0;
+    History->tileCapacity = 0;
+    History->entries = NULL;
+    History->numEntries = 0;
+    History->entryCapacity = 0;
+    History->numApplied = 0;
+    History->hasFailed = 0;
+}
+
+
+/*
+    @brief: frees the buffers of an undo history and leaves it empty
+
+    @param: History - pointer to the history
+*/
+void freeUndoHistory(struct UndoHistory *History) {
+    free(History->tiles);
+    free(History->entries);
+    initializeUndoHistory(History);
+}
+
+
+/*
+    @brief: empties an undo history, keeping its buffers for the next game
+
+    @param: History - pointer to the history
+*/
+void clearUndoHistory(struct UndoHistory *History) {
+    History->numTiles = 0;
+    History->numEntries = 0;
+    History->numApplied = 0;
+    History->hasFailed = 0;
+}
+
+
+/*
+    @brief: starts recording an action, discarding the actions that were undone since they can no
+        longer be redone
+
+    @param: History - pointer to the history
+    @param: type - 'I' - inspect, 'F' - flag, 'R' - remove flag
+
+    Precondition: the action changes at least one tile
+*/
+void beginUndoEntry(struct UndoHistory *History, char type) {
+    int newCapacity;
+    struct UndoEntry *newEntries;
+
+    History->numEntries = History->numApplied;
+    History->numTiles = History->numEntries > 0 ?
+        History->entries[History->numEntries - 1].start + History->entries[History->numEntries - 1].numTiles : 0;
+    History->hasFailed = 0;
+
+    if (History->numEntries == History->entryCapacity) {
+        newCapacity = History->entryCapacity == 0 ? 64 : History->entryCapacity * 2;
+        newEntries = realloc(History->entries, newCapacity * sizeof(struct UndoEntry));
+
+        if (newEntries == NULL) {
+            History->hasFailed = 1;
+            return;
+        }
+
+        History->entries = newEntries;
+        History->entryCapacity = newCapacity;
+    }
+
+    History->entries[History->numEntries].type = type;
+    History->entries[History->numEntries].start = History->numTiles;
+    History->entries[History->numEntries].numTiles = 0;
+}
+
+
+/*
+    @brief: records a tile changed by the action being recorded, growing the arena when it is full
+
+    @param: History - pointer to the history
+    @param: tile - flat index of the tile
+*/
+void recordUndoTile(struct UndoHistory *History, int tile) {
+    int newCapacity;
+    int *newTiles;
+
+    if (History->hasFailed) return;
+
+    if (History->numTiles == History->tileCapacity) {
+        newCapacity = History->tileCapacity == 0 ? 64 : History->tileCapacity * 2;
+        newTiles = realloc(History->tiles, newCapacity * sizeof(int));
+
+        if (newTiles == NULL) {
+            History->hasFailed = 1;
+            return;
+        }
+
+        History->tiles = newTiles;
+        History->tileCapacity = newCapacity;
+    }
+
+    History->tiles[History->numTiles++] = tile;
+    History->entries[History->numEntries].numTiles++;
+}
+
+
+/*
+    @brief: finishes recording an action. Once there are more than UNDO_MAX_ACTIONS actions, the
+        older half is dropped, so a long game keeps a bounded history at a constant cost per
+        action on average. If memory ran out while recording, the action cannot be undone, and
+        neither can the ones before it, so the whole history is dropped.
+
+    @param: History - pointer to the history
+*/
+void endUndoEntry(struct UndoHistory *History) {
+    int numDropped, firstKept;
+    int i;
+
+    if (History->hasFailed) {
+        clearUndoHistory(History);
+        return;
+    }
+
+    History->numEntries++;
+    History->numApplied = History->numEntries;
+
+    if (History->numEntries > UNDO_MAX_ACTIONS) {
+        numDropped = History->numEntries / 2;
+        firstKept = History->entries[numDropped].start;
+
+        memmove(History->tiles, History->tiles + firstKept, (History->numTiles - firstKept) * sizeof(int));
+        memmove(History->entries, History->entries + numDropped,
+            (History->numEntries - numDropped) * sizeof(struct UndoEntry));
+
+        History->numTiles -= firstKept;
+        History->numEntries -= numDropped;
+        History->numApplied = History->numEntries;
+
+        for (i = 0; i < History->numEntries; i++) {
+            History->entries[i].start -= firstKept;
+        }
+    }
+}
+
+
+/*
+    @brief: hides or reveals again the tiles of an inspection, keeping the board's counters for
+        getGameState up to date; an inspected mine is exploded or restored along with its tile
+
+    @param: Board - pointer to the current game board
+    @param: Entry - pointer to the recorded inspection
+    @param: tiles - the history's arena
+    @param: isRevealed - 1 to reveal the tiles again, 0 to hide them
+*/
+void setEntryRevealed(struct Board *Board, struct UndoEntry *Entry, int tiles[], int isRevealed) {
+    int index;
+    int i;
+
+    for (i = Entry->start; i < Entry->start + Entry->numTiles; i++) {
+        index = tiles[i];
+        setBit(Board->revealedPlane, index, isRevealed);
+
+        if (Board->states[index] >= 9) { // the inspected mine
+            Board->states[index] = isRevealed ? 10 : 9;
+            Board->explodedTile = isRevealed ? index : -1;
+        }
+        else {
+            Board->numHiddenSafe += isRevealed ? -1 : 1;
+        }
+    }
+}
+
+
+/*
+    @brief: undoes the last applied action, changing back only the tiles it changed
+
+    @param: Board - pointer to the current game board
+    @param: History - pointer to the game's undo history
+
+    @return: the flat index of a tile the action changed; -1 if there is nothing to undo
+*/
+int undoAction(struct Board *Board, struct UndoHistory *History) {
+    struct UndoEntry *Entry;
+
+    if (History->numApplied == 0) return -1;
+
+    Entry = &History->entries[--History->numApplied];
+
+    if (Entry->type == 'I') {
+        setEntryRevealed(Board, Entry, History->tiles, 0);
+    }
+    else {
+        setBit(Board->flaggedPlane, History->tiles[Entry->start], Entry->type == 'R');
+    }
+
+    return History->tiles[Entry->start];
+}
+
+
+/*
+    @brief: applies again the last undone action, changing only the tiles it changed
+
+    @param: Board - pointer to the current game board
+    @param: History - pointer to the game's undo history
+
+    @return: the flat index of a tile the action changed; -1 if there is nothing to redo
+*/
+int redoAction(struct Board *Board, struct UndoHistory *History) {
+    struct UndoEntry *Entry;
+
+    if (History->numApplied == History->numEntries) return -1;
+
+    Entry = &History->entries[History->numApplied++];
+
+    if (Entry->type == 'I') {
+        setEntryRevealed(Board, Entry, History->tiles, 1);
+    }
+    else {
+        setBit(Board->flaggedPlane, History->tiles[Entry->start], Entry->type == 'F');
+    }
+
+    return History->tiles[Entry->start];
+}
+
+
+/*
+    @brief: pushes a tile onto the board's work stack, growing the stack when it is full
+
+    @param: Board - pointer to the current game board
+    @param: top - pointer to the number of tiles currently on the stack
+    @param: index - flat index of the tile being pushed
+
+    @return: 1 - tile was pushed
+             0 - not enough memory to grow the stack
+*/
+int pushWorkStack(struct Board *Board, int *top, int index) {
+    int newCapacity;
+    int *newStack;
+
+    if (*top == Board->workCapacity) {
+        newCapacity = Board->workCapacity == 0 ? 64 : Board->workCapacity * 2;
+        newStack = realloc(Board->workStack, newCapacity * sizeof(int));
+        if (newStack == NULL) return 0;
+
+        Board->workStack = newStack;
+        Board->workCapacity = newCapacity;
+    }
+
+    Board->workStack[(*top)++] = index;
+    return 1;
+}
+
+
+/*
+    @brief: checks if a tile is an unrevealed blank, i.e., a tile that still has to open its own span
+
+    @param: Board - pointer to the current game board
+    @param: index - flat index of the tile
+
+    @return: 1 - tile is an unrevealed blank
+             0 - tile is revealed or has nearby mines
+*/
+int isHiddenBlank(struct Board *Board, int index) {
+    return Board->states[index] == 0 && !getBit(Board->revealedPlane, index);
+}
+
+
+/*
+    @brief: reveals a tile; continues revealing tiles adjacent to it if it is a blank. Blanks are
+        opened one horizontal span at a time: the span and its border are revealed in its own row,
+        and the rows above and below are revealed over the same range. Runs of unrevealed blanks
+        found there are pushed once onto the board's work stack to open their own spans, so every
+        tile is revealed exactly once and there is no recursion.
+	
+	@param: Board - pointer to the current game board
+	@param: row - the row of the tile inspected
+	@param: column - the column of the tile inspected
+	@param: History - pointer to the undo history that records the tiles revealed; NULL to not record
+
+	@return: the number of tiles revealed by this inspection
+	
+	Precondition: The board information is accurate. Tiles are only revealed through this function
+        or setTileRevealed, which keep the board's counters for getGameState. If recording, an undo
+        entry has been begun.
+*/
+int revealRecordedTiles(struct Board *Board, int row, int column, struct UndoHistory *History) {
+    int numRevealed = 0;
+    int top = 0;
+    int index, spanRow, spanColumn;
+    int left, right;
+    int i, j;
+    int isInRun;
+    int columns = Board->columns;
+
+    int validRow = row >= 0 && row <= Board->rows - 1;
+    int validColumn = column >= 0 && column <= columns - 1;
+
+    if (!validRow || !validColumn) return 0;
+    if (isTileRevealed(Board, row, column)) return 0;
+
+    if (getTileState(Board, row, column) == 9) { // a mine; the game is lost
+        index = getTileIndex(Board, row, column);
+        setBit(Board->revealedPlane, index, 1);
+        Board->states[index] = 10;
+        Board->explodedTile = index;
+        if (History != NULL) recordUndoTile(History, index);
+        return 1;
+    }
+
+    if (getTileState(Board, row, column) != 0) { // a number; nothing cascades
+        setTileRevealed(Board, row, column, 1);
+        if (History != NULL) recordUndoTile(History, getTileIndex(Board, row, column));
+        return 1;
+    }
+
+    // at this point, the tile is confirmed to be an unrevealed blank, triggering the cascading
+    pushWorkStack(Board, &top, getTileIndex(Board, row, column));
+
+    while (top > 0) {
+        index = Board->workStack[--top];
+        if (getBit(Board->revealedPlane, index)) continue; // its run was opened from another span
+
+        spanRow = index / columns;
+        spanColumn = index % columns;
+
+        // extend the span over the unrevealed blanks to the left and right
+        left = spanColumn;
+        while (left > 0 && isHiddenBlank(Board, index - (spanColumn - left) - 1)) left--;
+        right = spanColumn;
+        while (right < columns - 1 && isHiddenBlank(Board, index + (right - spanColumn) + 1)) right++;
+
+        // every tile touching the span is revealed, except blanks in the rows above and below,
+        // which are left to open their own spans
+        if (left > 0) left--;
+        if (right < columns - 1) right++;
+
+        for (i = spanRow - 1; i <= spanRow + 1; i++) {
+            if (i < 0 || i > Board->rows - 1) continue;
+
+            isInRun = 0;
+            for (j = left; j <= right; j++) {
+                index = i * columns + j;
+
+                if (getBit(Board->revealedPlane, index)) {
+                    isInRun = 0;
+                }
+                else if (i != spanRow && Board->states[index] == 0) { // unrevealed blank
+                    if (!isInRun && !pushWorkStack(Board, &top, index)) { // out of memory; the cascade stops here
+                        Board->numHiddenSafe -= numRevealed; // the tiles already opened still count
+                        return numRevealed;
+                    }
+                    isInRun = 1;
+                }
+                else { // tiles touching a blank are never mines
+                    setBit(Board->revealedPlane, index, 1);
+                    if (History != NULL) recordUndoTile(History, index);
+                    numRevealed++;
+                    isInRun = 0;
+                }
+            }
+        }
+    }
+
+    Board->numHiddenSafe -= numRevealed;
+    return numRevealed;
+}
+
+
+/*
+	@brief: reveals a tile, cascading over blanks, without recording it for undoing (see
+        revealRecordedTiles)
+	
+	@param: Board - pointer to the current game board
+	@param: row - the row of the tile inspected
+	@param: column - the column of the tile inspected
+
+	@return: the number of tiles revealed by this inspection
+*/
+int revealTiles(struct Board *Board, int row, int column) {
+    return revealRecordedTiles(Board, row, column, NULL);
+}
+
+
+/*
+	@brief: determines the current state of the game (ongoing/won/lost) from the counters that
+        revealTiles keeps, without looking at any tile
+	
+	@param: Board - pointer to the current game board
+	
+	@return: 0 - game is ongoing
+			 1 - won
+			 2 - lost
+*/
+int getGameState(struct Board *Board) {
+    if (Board->explodedTile >= 0) return 2; // a mine has been inspected; game is lost
+    if (Board->numHiddenSafe > 0) return 0; // not all non-mine tiles have been revealed; game is ongoing
+    return 1; // all non-mine tiles have been revealed; game is won
+}
+
+
+/*
+    @brief: sets the revealed bit of all mines to a particular value; effectively hides/reveals
+        all mines. Only the mines listed in the mine index are visited.
+	
+	@param: visibility - 1 to reveal all mines, 0 to hide them
+	@param: Board - pointer to the current game board
+
+    Precondition: Assumes visibility is 1 or 0.
+*/
+void setMineVisibility(int visibility, struct Board *Board) {
+    int i;
+
+    for (i = 0; i < Board->Mines.numMines; i++) {
+        setBit(Board->revealedPlane, Board->Mines.cells[i], visibility);
+    }
+}
+
+
+/*
+    @brief: prepares a solver for first use; the solver holds no buffers until it is given a board
+
+    @param: Solver - pointer to the solver being initialized
+*/
+void initializeSolver(struct Solver *Solver) {
+    Solver->capacity = 0;
+    Solver->minePlane = NULL;
+    Solver->safePlane = NULL;
+    Solver->savedFlags = NULL;
+    Solver->constraintOfTile = NULL;
+    Solver->slotOfTile = NULL;
+
+    Solver->constraints = NULL;
+    Solver->numConstraints = 0;
+    Solver->constraintCapacity = 0;
+    Solver->queue = NULL;
+    Solver->queueStart = 0;
+    Solver->queueLength = 0;
+    Solver->isInconsistent = 0;
+
+    Solver->safeCells = NULL;
+    Solver->numSafe = 0;
+    Solver->mineCells = NULL;
+    Solver->numMines = 0;
+
+    Solver->numComponents = 0;
+    Solver->componentCells = NULL;
+    Solver->numComponentCells = 0;
+}
+
+
+/*
+    @brief: releases the buffers of a solver
+
+    @param: Solver - pointer to the solver being freed
+*/
+void freeSolver(struct Solver *Solver) {
+    free(Solver->minePlane);
+    free(Solver->safePlane);
+    free(Solver->savedFlags);
+    free(Solver->constraintOfTile);
+    free(Solver->slotOfTile);
+    free(Solver->constraints);
+    free(Solver->queue);
+    free(Solver->safeCells);
+    free(Solver->mineCells);
+    free(Solver->componentCells);
+    initializeSolver(Solver);
+}
+
+
+/*
+    @brief: makes sure the buffers of a solver can hold a board, reallocating them if it is larger
+        than any board before it
+
+    @param: Solver - pointer to the solver
+    @param: Board - pointer to the board about to be solved
+
+    @return: 1 - solver is ready
+             0 - not enough memory (the solver is left empty)
+*/
+int prepareSolver(struct Solver *Solver, struct Board *Board) {
+    int i;
+    int numTiles = Board->rows * Board->columns;
+    int numWords = getNumWords(Board);
+
+    if (numTiles > Solver->capacity) {
+        freeSolver(Solver);
+
+        Solver->minePlane = malloc(numWords * sizeof(bitword));
+        Solver->safePlane = malloc(numWords * sizeof(bitword));
+        Solver->savedFlags = malloc(numWords * sizeof(bitword));
+        Solver->constraintOfTile = malloc(numTiles * sizeof(int));
+        Solver->slotOfTile = malloc(numTiles * sizeof(int));
+        Solver->safeCells = malloc(numTiles * sizeof(int));
+        Solver->mineCells = malloc(numTiles * sizeof(int));
+        Solver->componentCells = malloc(numTiles * sizeof(int));
+
+        if (Solver->minePlane == NULL || Solver->safePlane == NULL || Solver->savedFlags == NULL ||
+            Solver->constraintOfTile == NULL || Solver->slotOfTile == NULL || Solver->safeCells == NULL ||
+            Solver->mineCells == NULL || Solver->componentCells == NULL) {
+            freeSolver(Solver);
+            return 0;
+        }
+
+        // afterwards, only the entries a solve has set are put back to -1
+        for (i = 0; i < numTiles; i++) {
+            Solver->constraintOfTile[i] = -1;
+            Solver->slotOfTile[i] = -1;
+        }
+
+        Solver->capacity = numTiles;
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: adds a constraint to the solver, growing the constraint list and its queue when full
+
+    @param: Solver - pointer to the solver
+    @param: tile - flat index of the revealed number
+    @param: cells - its neighbors that are not yet known
+    @param: numCells - number of cells
+    @param: numMines - mines among the cells
+
+    @return: 1 - constraint was added
+             0 - not enough memory
+*/
+int addConstraint(struct Solver *Solver, int tile, int cells[], int numCells, int numMines) {
+    int newCapacity;
+    struct Constraint *newConstraints;
+    int *newQueue;
+    struct Constraint *Constraint;
+
+    if (Solver->numConstraints == Solver->constraintCapacity) {
+        newCapacity = Solver->constraintCapacity == 0 ? 64 : Solver->constraintCapacity * 2;
+
+        newConstraints = realloc(Solver->constraints, newCapacity * sizeof(struct Constraint));
+        if (newConstraints == NULL) return 0;
+        Solver->constraints = newConstraints;
+
+        newQueue = realloc(Solver->queue, newCapacity * sizeof(int));
+        if (newQueue == NULL) return 0;
+        Solver->queue = newQueue;
+
+        Solver->constraintCapacity = newCapacity;
+    }
+
+    Constraint = &Solver->constraints[Solver->numConstraints];
+    Constraint->tile = tile;
+    memcpy(Constraint->cells, cells, numCells * sizeof(int));
+    Constraint->numCells = numCells;
+    Constraint->numMines = numMines;
+    Constraint->isQueued = 0;
+    Constraint->component = -1;
+    Constraint->isChanged = 1;
+
+    Solver->constraintOfTile[tile] = Solver->numConstraints++;
+    return 1;
+}
+
+
+/*
+    @brief: puts a constraint at the back of the solver's queue unless it is already waiting there
+
+    @param: Solver - pointer to the solver
+    @param: index - index of the constraint
+*/
+void queueConstraint(struct Solver *Solver, int index) {
+    if (Solver->constraints[index].isQueued) return;
+
+    Solver->constraints[index].isQueued = 1;
+    Solver->queue[(Solver->queueStart + Solver->queueLength) % Solver->constraintCapacity] = index;
+    Solver->queueLength++;
+}
+
+
+/*
+    @brief: records that a cell is certainly a mine or certainly safe. The cell is removed from the
+        constraints of the numbers around it, which are queued to be checked again; a constraint
+        left with more mines than cells, or fewer than none, marks the position inconsistent.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to the solver
+    @param: cell - flat index of the cell
+    @param: isMine - 1 if the cell is a mine, 0 if it is safe
+*/
+void markCell(struct Board *Board, struct Solver *Solver, int cell, int isMine) {
+    int k, l, i;
+    int row = cell / Board->columns;
+    int column = cell % Board->columns;
+    int index;
+    struct Constraint *Constraint;
+
+    if (getBit(Solver->minePlane, cell) || getBit(Solver->safePlane, cell)) {
+        if (getBit(Solver->minePlane, cell) != isMine) Solver->isInconsistent = 1;
+        return;
+    }
+
+    if (isMine) {
+        setBit(Solver->minePlane, cell, 1);
+        Solver->mineCells[Solver->numMines++] = cell;
+    }
+    else {
+        setBit(Solver->safePlane, cell, 1);
+        Solver->safeCells[Solver->numSafe++] = cell;
+    }
+
+    for (k = row - 1; k <= row + 1; k++) {
+        for (l = column - 1; l <= column + 1; l++) {
+            if (k < 0 || k >= Board->rows || l < 0 || l >= Board->columns) continue;
+
+            index = Solver->constraintOfTile[getTileIndex(Board, k, l)];
+            if (index < 0) continue;
+
+            Constraint = &Solver->constraints[index];
+            for (i = 0; i < Constraint->numCells && Constraint->cells[i] != cell; i++);
+            if (i == Constraint->numCells) continue;
+
+            Constraint->cells[i] = Constraint->cells[--Constraint->numCells];
+            Constraint->numMines -= isMine;
+            Constraint->isChanged = 1;
+
+            if (Constraint->numMines < 0 || Constraint->numMines > Constraint->numCells) {
+                Solver->isInconsistent = 1;
+            }
+
+            queueConstraint(Solver, index);
+        }
+    }
+}
+
+
+/*
+    @brief: turns every revealed number of the board into a constraint over its unknown neighbors
+        and queues them all. Flagged tiles are taken as known mines if flags are trusted.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to a solver prepared for the board
+    @param: isTrustingFlags - 1 if the flags are known to be right, 0 if they are ignored
+
+    @return: 1 - constraints were built
+             0 - not enough memory
+*/
+int buildConstraints(struct Board *Board, struct Solver *Solver, int isTrustingFlags) {
+    int i, k, l;
+    int index, neighbor;
+    int row, column;
+    int numWords = getNumWords(Board);
+    int cells[8];
+    int numCells, numMines;
+    bitword word;
+
+    // forget the constraints of the last solve
+    for (i = 0; i < Solver->numConstraints; i++) {
+        Solver->constraintOfTile[Solver->constraints[i].tile] = -1;
+    }
+
+    Solver->numConstraints = 0;
+    Solver->queueStart = 0;
+    Solver->queueLength = 0;
+    Solver->isInconsistent = 0;
+    Solver->numSafe = 0;
+    Solver->numMines = 0;
+    Solver->numComponents = 0;
+
+    for (i = 0; i < numWords; i++) {
+        Solver->minePlane[i] = isTrustingFlags ? Board->flaggedPlane[i] & ~Board->revealedPlane[i] : 0;
+        Solver->safePlane[i] = 0;
+    }
+
+    for (i = 0; i < numWords; i++) {
+        word = Board->revealedPlane[i];
+
+        while (word) { // visit each revealed tile
+            index = i * WORD_BITS + __builtin_ctzll(word);
+            word &= word - 1;
+
+            if (Board->states[index] > 8) continue; // an exploded mine says nothing
+
+            row = index / Board->columns;
+            column = index % Board->columns;
+            numCells = 0;
+            numMines = Board->states[index];
+
+            for (k = row - 1; k <= row + 1; k++) {
+                for (l = column - 1; l <= column + 1; l++) {
+                    if (k < 0 || k >= Board->rows || l < 0 || l >= Board->columns) continue;
+
+                    neighbor = getTileIndex(Board, k, l);
+
+                    if (getBit(Solver->minePlane, neighbor)) {
+                        numMines--;
+                    }
+                    else if (!getBit(Board->revealedPlane, neighbor)) {
+                        cells[numCells++] = neighbor;
+                    }
+                }
+            }
+
+            if (numMines < 0 || numMines > numCells) {
+                Solver->isInconsistent = 1;
+            }
+            else if (numCells > 0 && !addConstraint(Solver, index, cells, numCells, numMines)) {
+                return 0;
+            }
+        }
+    }
+
+    for (i = 0; i < Solver->numConstraints; i++) {
+        queueConstraint(Solver, i);
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: compares a constraint with another one that shares cells with it. The shared cells hold
+        at most as many mines as either constraint and at least as many as either one cannot fit
+        in its own cells, which bounds the mines in the cells each one has alone; cells that must
+        all be mines or all be safe are marked. This covers the subset rule (one constraint's
+        cells inside the other's) as well as overlaps that are not subsets.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to the solver
+    @param: first - index of the first constraint
+    @param: second - index of the second constraint
+
+    @return: 1 - a cell was marked
+             0 - nothing could be deduced
+*/
+int compareConstraints(struct Board *Board, struct Solver *Solver, int first, int second) {
+    struct Constraint *A = &Solver->constraints[first];
+    struct Constraint *B = &Solver->constraints[second];
+    int onlyA[8], onlyB[8];
+    int numOnlyA = 0, numOnlyB = 0;
+    int numShared;
+    int minShared, maxShared;
+    int minOnlyA, maxOnlyA, minOnlyB, maxOnlyB;
+    int i, j;
+
+    for (i = 0; i < A->numCells; i++) {
+        for (j = 0; j < B->numCells && B->cells[j] != A->cells[i]; j++);
+        if (j == B->numCells) onlyA[numOnlyA++] = A->cells[i];
+    }
+
+    numShared = A->numCells - numOnlyA;
+    if (numShared == 0) return 0;
+
+    for (i = 0; i < B->numCells; i++) {
+        for (j = 0; j < A->numCells && A->cells[j] != B->cells[i]; j++);
+        if (j == A->numCells) onlyB[numOnlyB++] = B->cells[i];
+    }
+
+    maxShared = numShared;
+    if (A->numMines < maxShared) maxShared = A->numMines;
+    if (B->numMines < maxShared) maxShared = B->numMines;
+
+    minShared = 0;
+    if (A->numMines - numOnlyA > minShared) minShared = A->numMines - numOnlyA;
+    if (B->numMines - numOnlyB > minShared) minShared = B->numMines - numOnlyB;
+
+    minOnlyA = A->numMines - maxShared;
+    maxOnlyA = A->numMines - minShared;
+    minOnlyB = B->numMines - maxShared;
+    maxOnlyB = B->numMines - minShared;
+
+    // the cells are copied above, since marking them changes both constraints
+    if (numOnlyA > 0 && (maxOnlyA == 0 || minOnlyA == numOnlyA)) {
+        for (i = 0; i < numOnlyA; i++) markCell(Board, Solver, onlyA[i], maxOnlyA != 0);
+    }
+    else numOnlyA = 0;
+
+    if (numOnlyB > 0 && (maxOnlyB == 0 || minOnlyB == numOnlyB)) {
+        for (i = 0; i < numOnlyB; i++) markCell(Board, Solver, onlyB[i], maxOnlyB != 0);
+    }
+    else numOnlyB = 0;
+
+    return numOnlyA > 0 || numOnlyB > 0;
+}
+
+
+/*
+    @brief: checks queued constraints until the queue is empty. A constraint with no mines left
+        makes all of its cells safe and one with as many mines as cells makes them all mines;
+        otherwise it is compared with every constraint whose number is close enough to share cells
+        with it. Constraints whose cells change are queued again.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to the solver
+*/
+void propagateConstraints(struct Board *Board, struct Solver *Solver) {
+    int i, k, l;
+    int index, other;
+    int row, column;
+    int cells[8];
+    int numCells;
+    int isScanning;
+    struct Constraint *Constraint;
+
+    while (Solver->queueLength > 0 && !Solver->isInconsistent) {
+        index = Solver->queue[Solver->queueStart];
+        Solver->queueStart = (Solver->queueStart + 1) % Solver->constraintCapacity;
+        Solver->queueLength--;
+
+        Constraint = &Solver->constraints[index];
+        Constraint->isQueued = 0;
+        if (Constraint->numCells == 0) continue;
+
+        if (Constraint->numMines == 0 || Constraint->numMines == Constraint->numCells) {
+            numCells = Constraint->numCells;
+            memcpy(cells, Constraint->cells, numCells * sizeof(int));
+
+            for (i = 0; i < numCells; i++) {
+                markCell(Board, Solver, cells[i], Constraint->numMines != 0);
+            }
+            continue;
+        }
+
+        // numbers up to two tiles away can share neighbors with this one; the scan stops once this
+        // constraint has no cells left to compare or the position is found inconsistent
+        row = Constraint->tile / Board->columns;
+        column = Constraint->tile % Board->columns;
+        isScanning = 1;
+
+        for (k = row - 2; k <= row + 2 && isScanning; k++) {
+            for (l = column - 2; l <= column + 2 && isScanning; l++) {
+                if (k < 0 || k >= Board->rows || l < 0 || l >= Board->columns) continue;
+
+                other = Solver->constraintOfTile[getTileIndex(Board, k, l)];
+                if (other < 0 || other == index || Solver->constraints[other].numCells == 0) continue;
+
+                compareConstraints(Board, Solver, index, other);
+                isScanning = Constraint->numCells > 0 && !Solver->isInconsistent;
+            }
+        }
+    }
+}
+
+
+/*
+    @brief: applies the total number of mines: if every mine is already known, the remaining
+        unknown tiles are safe, and if there are as many mines left as unknown tiles, they are all
+        mines. This also settles the interior tiles that no number touches.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to the solver
+
+    @return: 1 - tiles were marked
+             0 - the mine count settles nothing
+*/
+int applyMineCount(struct Board *Board, struct Solver *Solver) {
+    int i;
+    int numTiles = Board->rows * Board->columns;
+    int numWords = getNumWords(Board);
+    int numHidden = numTiles;
+    int numKnownMines = 0;
+    int numKnownSafe = 0;
+    int numUnknown, numMinesLeft;
+    int isMine;
+    bitword word, lastMask;
+
+    for (i = 0; i < numWords; i++) {
+        numHidden -= __builtin_popcountll(Board->revealedPlane[i]);
+        numKnownMines += __builtin_popcountll(Solver->minePlane[i]);
+        numKnownSafe += __builtin_popcountll(Solver->safePlane[i]);
+    }
+
+    numUnknown = numHidden - numKnownMines - numKnownSafe;
+    numMinesLeft = Board->Mines.numMines - numKnownMines;
+
+    if (numMinesLeft < 0 || numMinesLeft > numUnknown) {
+        Solver->isInconsistent = 1;
+        return 0;
+    }
+    if (numUnknown == 0 || (numMinesLeft != 0 && numMinesLeft != numUnknown)) return 0;
+
+    isMine = numMinesLeft != 0;
+    lastMask = numTiles % WORD_BITS == 0 ? ~0ULL : (1ULL << numTiles % WORD_BITS) - 1;
+
+    for (i = 0; i < numWords; i++) {
+        word = ~(Board->revealedPlane[i] | Solver->minePlane[i] | Solver->safePlane[i]);
+        if (i == numWords - 1) word &= lastMask;
+
+        while (word) {
+            markCell(Board, Solver, i * WORD_BITS + __builtin_ctzll(word), isMine);
+            word &= word - 1;
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: tries both values for one cell of the component being enumerated, then moves on to the
+        next cell; a value is dropped as soon as a constraint can no longer be met. Each complete
+        placement adds to the mine count of the cells that hold a mine in it. Enumeration stops
+        early, as if out of steps, once no cell can be settled any more.
+
+    @param: Solver - pointer to the solver
+    @param: slot - position of the cell in componentCells
+
+    Precondition: numAssigned and numAssignedMines are 0 for every constraint of the component
+        when enumeration starts at slot 0.
+*/
+void enumerateComponent(struct Solver *Solver, int slot) {
+    int i, value;
+    int isPossible;
+    int numUnsettled;
+    struct Constraint *Constraint;
+
+    if (Solver->numSteps >= Solver->maxSteps) return;
+    Solver->numSteps++;
+
+    if (slot == Solver->numComponentCells) { // every cell has a value; the placement is consistent
+        Solver->numPlacements++;
+        numUnsettled = 0;
+
+        for (i = 0; i < slot; i++) {
+            Solver->mineCounts[i] += Solver->assignment[i];
+            numUnsettled += Solver->mineCounts[i] > 0 && Solver->mineCounts[i] < Solver->numPlacements;
+        }
+
+        // once every cell has been both a mine and safe, the component can settle nothing
+        if (numUnsettled == slot) Solver->maxSteps = Solver->numSteps;
+        return;
+    }
+
+    for (value = 0; value <= 1; value++) {
+        isPossible = 1;
+        Solver->assignment[slot] = value;
+
+        for (i = 0; i < Solver->numCellConstraints[slot]; i++) {
+            Constraint = &Solver->constraints[Solver->cellConstraints[slot][i]];
+            Constraint->numAssigned++;
+            Constraint->numAssignedMines += value;
+
+            if (Constraint->numAssignedMines > Constraint->numMines ||
+                Constraint->numAssignedMines + Constraint->numCells - Constraint->numAssigned < Constraint->numMines) {
+                isPossible = 0;
+            }
+        }
+
+        if (isPossible) enumerateComponent(Solver, slot + 1);
+
+        for (i = 0; i < Solver->numCellConstraints[slot]; i++) {
+            Constraint = &Solver->constraints[Solver->cellConstraints[slot][i]];
+            Constraint->numAssigned--;
+            Constraint->numAssignedMines -= value;
+        }
+    }
+}
+
+
+/*
+    @brief: collects the frontier component of a constraint: every constraint connected to it
+        through shared cells, and their cells. Each cell gets a slot in componentCells, in the
+        order found, so that neighboring cells are near each other when the component is enumerated.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to the solver
+    @param: start - index of the constraint the component is grown from
+
+    @return: the number of constraints in the component, which are left at the front of the queue
+        buffer
+
+    Precondition: the queue is empty, so its buffer can hold the component's constraints.
+*/
+int collectComponent(struct Board *Board, struct Solver *Solver, int start) {
+    int i, k, l;
+    int index, cell, other;
+    int numFound = 1;
+    int next = 0;
+    struct Constraint *Constraint;
+
+    Solver->numComponentCells = 0;
+    Solver->constraints[start].component = Solver->numComponents;
+    Solver->queue[0] = start;
+
+    while (next < numFound) {
+        index = Solver->queue[next++];
+        Constraint = &Solver->constraints[index];
+        Constraint->numAssigned = 0;
+        Constraint->numAssignedMines = 0;
+
+        for (i = 0; i < Constraint->numCells; i++) {
+            cell = Constraint->cells[i];
+            if (Solver->slotOfTile[cell] >= 0) continue;
+
+            Solver->slotOfTile[cell] = Solver->numComponentCells;
+            Solver->componentCells[Solver->numComponentCells++] = cell;
+
+            // the numbers around the cell belong to the same component
+            for (k = cell / Board->columns - 1; k <= cell / Board->columns + 1; k++) {
+                for (l = cell % Board->columns - 1; l <= cell % Board->columns + 1; l++) {
+                    if (k < 0 || k >= Board->rows || l < 0 || l >= Board->columns) continue;
+
+                    other = Solver->constraintOfTile[getTileIndex(Board, k, l)];
+                    if (other < 0 || Solver->constraints[other].numCells == 0 ||
+                        Solver->constraints[other].component >= 0) continue;
+
+                    Solver->constraints[other].component = Solver->numComponents;
+                    Solver->queue[numFound++] = other;
+                }
+            }
+        }
+    }
+
+    Solver->numComponents++;
+    return numFound;
+}
+
+
+/*
+    @brief: splits the frontier into components that share no cells and enumerates every placement
+        of mines in each one small enough; a cell that is a mine in every placement, or in none, is
+        marked. Components are independent, so each one costs time only in its own size, and one
+        whose constraints have not changed since it was last enumerated is skipped, since it would
+        settle nothing again. The components of one solve share SOLVER_MAX_SOLVE_STEPS steps, so
+        a frontier of many hard components cannot stall a hint; the ones left over are skipped.
+
+    @param: Board - pointer to the board being solved
+    @param: Solver - pointer to the solver
+
+    @return: 1 - cells were marked
+             0 - enumeration settled nothing
+*/
+int enumerateComponents(struct Board *Board, struct Solver *Solver) {
+    int i, j, k, l;
+    int index, cell;
+    int numFound;
+    int isChanged;
+    int numMarked = 0;
+
+    Solver->numComponents = 0;
+    for (i = 0; i < Solver->numConstraints; i++) {
+        Solver->constraints[i].component = -1;
+    }
+
+    for (i = 0; i < Solver->numConstraints && !Solver->isInconsistent; i++) {
+        if (Solver->constraints[i].numCells == 0 || Solver->constraints[i].component >= 0) continue;
+
+        numFound = collectComponent(Board, Solver, i);
+
+        isChanged = 0;
+        for (j = 0; j < numFound; j++) {
+            isChanged |= Solver->constraints[Solver->queue[j]].isChanged;
+            Solver->constraints[Solver->queue[j]].isChanged = 0;
+        }
+
+        if (isChanged && Solver->numComponentCells <= SOLVER_MAX_COMPONENT && Solver->numStepsLeft > 0) {
+            // list the constraints each cell appears in
+            for (j = 0; j < Solver->numComponentCells; j++) {
+                cell = Solver->componentCells[j];
+                Solver->numCellConstraints[j] = 0;
+                Solver->mineCounts[j] = 0;
+
+                for (k = cell / Board->columns - 1; k <= cell / Board->columns + 1; k++) {
+                    for (l = cell % Board->columns - 1; l <= cell % Board->columns + 1; l++) {
+                        if (k < 0 || k >= Board->rows || l < 0 || l >= Board->columns) continue;
+
+                        index = Solver->constraintOfTile[getTileIndex(Board, k, l)];
+                        if (index < 0 || Solver->constraints[index].numCells == 0) continue;
+
+                        Solver->cellConstraints[j][Solver->numCellConstraints[j]++] = index;
+                    }
+                }
+            }
+
+            Solver->numPlacements = 0;
+            Solver->numSteps = 0;
+            Solver->maxSteps = SOLVER_MAX_STEPS;
+            if (Solver->numStepsLeft < Solver->maxSteps) Solver->maxSteps = Solver->numStepsLeft;
+            enumerateComponent(Solver, 0);
+            Solver->numStepsLeft -= Solver->numSteps;
+
+            if (Solver->numSteps < Solver->maxSteps) { // the enumeration was complete
+                if (Solver->numPlacements == 0) Solver->isInconsistent = 1;
+
+                for (j = 0; j < Solver->numComponentCells && !Solver->isInconsistent; j++) {
+                    if (Solver->mineCounts[j] == 0 || Solver->mineCounts[j] == Solver->numPlacements) {
+                        markCell(Board, Solver, Solver->componentCells[j], Solver->mineCounts[j] != 0);
+                        numMarked++;
+                    }
+                }
+            }
+        }
+
+        for (j = 0; j < Solver->numComponentCells; j++) {
+            Solver->slotOfTile[Solver->componentCells[j]] = -1;
+        }
+    }
+
+    // marking cells queued their constraints while the queue buffer held the components, so the
+    // queue is rebuilt from every constraint that still has cells
+    if (numMarked > 0) {
+        Solver->queueStart = 0;
+        Solver->queueLength = 0;
+
+        for (i = 0; i < Solver->numConstraints; i++) {
+            Solver->constraints[i].isQueued = 0;
+        }
+        for (i = 0; i < Solver->numConstraints; i++) {
+            if (Solver->constraints[i].numCells > 0) queueConstraint(Solver, i);
+        }
+    }
+
+    return numMarked > 0;
+}
+
+
+/*
+    @brief: finds every hidden tile of a position that is certainly a mine or certainly safe, using
+        only what the player can see: the revealed numbers, the number of mines, and the flags if
+        they are trusted. Single numbers and pairs of overlapping numbers are checked first, then
+        the mine count; the frontier components are only enumerated when those settle nothing.
+        The deductions are left in the solver's safeCells and mineCells.
+
+    @param: Board - pointer to the board of the position
+    @param: Solver - pointer to the solver; its buffers grow to fit the board
+    @param: isTrustingFlags - 1 if flagged tiles are known mines, 0 if flags are ignored
+
+    @return: the number of tiles deduced (0 if there was not enough memory); -1 if no placement of
+        mines agrees with the position, which only happens when a trusted flag is wrong
+*/
+int solvePosition(struct Board *Board, struct Solver *Solver, int isTrustingFlags) {
+    int hasProgress = 1;
+
+    if (!prepareSolver(Solver, Board) || !buildConstraints(Board, Solver, isTrustingFlags)) return 0;
+    Solver->numStepsLeft = SOLVER_MAX_SOLVE_STEPS;
+
+    while (hasProgress && !Solver->isInconsistent) {
+        propagateConstraints(Board, Solver);
+
+        hasProgress = !Solver->isInconsistent &&
+            (applyMineCount(Board, Solver) || enumerateComponents(Board, Solver));
+    }
+
+    if (Solver->isInconsistent) return -1;
+    return Solver->numSafe + Solver->numMines;
+}
+
+
+/*
+    @brief: plays a board from its first inspection using the solver alone, to find out if it can
+        be won without guessing. Deduced mines are flagged, so later solves trust them, and deduced
+        safe tiles are inspected, until the board is won or nothing more can be deduced. Flags
+        already on the board are cleared first, since they may be wrong.
+
+    @param: Board - pointer to the board; tiles are revealed and flagged on it, so it should be
+        reset afterwards
+    @param: Solver - pointer to the solver
+    @param: row - row of the first inspection
+    @param: column - column of the first inspection
+
+    @return: 1 - board can be won without guessing
+             0 - a guess is needed at some point
+*/
+int isSolvableFrom(struct Board *Board, struct Solver *Solver, int row, int column) {
+    int i;
+
+    memset(Board->flaggedPlane, 0, getNumWords(Board) * sizeof(bitword));
+    revealTiles(Board, row, column);
+
+    while (Board->numHiddenSafe > 0 && solvePosition(Board, Solver, 1) > 0) {
+        for (i = 0; i < Solver->numMines; i++) {
+            setBit(Board->flaggedPlane, Solver->mineCells[i], 1);
+        }
+        for (i = 0; i < Solver->numSafe; i++) {
+            revealTiles(Board, Solver->safeCells[i] / Board->columns, Solver->safeCells[i] % Board->columns);
+        }
+    }
+
+    return Board->numHiddenSafe == 0;
+}
+
+
+/*
+    @brief: gets the number of processors of the computer
+
+    @return: the number of processors; at least 1
+*/
+int getNumProcessors() {
+#ifdef _WIN32
+    SYSTEM_INFO Info;
+
+    GetSystemInfo(&Info);
+    return Info.dwNumberOfProcessors > 0 ? (int) Info.dwNumberOfProcessors : 1;
+#else
+    long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return numProcessors > 0 ? (int) numProcessors : 1;
+#endif
+}
+
+
+/*
+    @brief: prepares a lock that lets one thread at a time through
+
+    @param: Lock - pointer to the lock
+*/
+void initializeLock(threadLock *Lock) {
+#ifdef _WIN32
+    InitializeCriticalSection(Lock);
+#else
+    pthread_mutex_init(Lock, NULL);
+#endif
+}
+
+
+/*
+    @brief: releases the resources of a lock
+
+    @param: Lock - pointer to the lock
+
+    Precondition: no thread holds the lock.
+*/
+void freeLock(threadLock *Lock) {
+#ifdef _WIN32
+    DeleteCriticalSection(Lock);
+#else
+    pthread_mutex_destroy(Lock);
+#endif
+}
+
+
+/*
+    @brief: waits until no other thread holds a lock, then holds it
+
+    @param: Lock - pointer to the lock
+*/
+void acquireLock(threadLock *Lock) {
+#ifdef _WIN32
+    EnterCriticalSection(Lock);
+#else
+    pthread_mutex_lock(Lock);
+#endif
+}
+
+
+/*
+    @brief: lets go of a lock held by the calling thread
+
+    @param: Lock - pointer to the lock
+*/
+void releaseLock(threadLock *Lock) {
+#ifdef _WIN32
+    LeaveCriticalSection(Lock);
+#else
+    pthread_mutex_unlock(Lock);
+#endif
+}
+
+
+/*
+    @brief: prepares a condition variable
+
+    @param: Condition - pointer to the condition variable
+*/
+void initializeCondition(threadCondition *Condition) {
+#ifdef _WIN32
+    InitializeConditionVariable(Condition);
+#else
+    pthread_cond_init(Condition, NULL);
+#endif
+}
+
+
+/*
+    @brief: releases the resources of a condition variable
+
+    @param: Condition - pointer to the condition variable
+
+    Precondition: no thread waits on the condition variable.
+*/
+void freeCondition(threadCondition *Condition) {
+#ifdef _WIN32
+    (void) Condition; // condition variables of Windows hold no resources
+#else
+    pthread_cond_destroy(Condition);
+#endif
+}
+
+
+/*
+    @brief: lets go of a lock and sleeps until a condition variable is signalled, then holds the
+        lock again. The thread may wake without a signal, so the condition is checked again.
+
+    @param: Condition - pointer to the condition variable
+    @param: Lock - pointer to the lock held by the calling thread
+*/
+void waitCondition(threadCondition *Condition, threadLock *Lock) {
+#ifdef _WIN32
+    SleepConditionVariableCS(Condition, Lock, INFINITE);
+#else
+    pthread_cond_wait(Condition, Lock);
+#endif
+}
+
+
+/*
+    @brief: like waitCondition, but gives up waiting for a signal after a time
+
+    @param: Condition - pointer to the condition variable
+    @param: Lock - pointer to the lock held by the calling thread
+    @param: milliseconds - longest time to sleep
+*/
+void waitConditionFor(threadCondition *Condition, threadLock *Lock, int milliseconds) {
+#ifdef _WIN32
+    SleepConditionVariableCS(Condition, Lock, milliseconds);
+#else
+    struct timespec Deadline; // pthread_cond_timedwait takes the time to wake on the realtime clock
+
+    clock_gettime(CLOCK_REALTIME, &Deadline);
+    Deadline.tv_sec += milliseconds / 1000;
+    Deadline.tv_nsec += milliseconds % 1000 * 1000000L;
+    if (Deadline.tv_nsec >= 1000000000L) {
+        Deadline.tv_sec++;
+        Deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_cond_timedwait(Condition, Lock, &Deadline);
+#endif
+}
+
+
+/*
+    @brief: wakes every thread waiting on a condition variable
+
+    @param: Condition - pointer to the condition variable
+*/
+void signalCondition(threadCondition *Condition) {
+#ifdef _WIN32
+    WakeAllConditionVariable(Condition);
+#else
+    pthread_cond_broadcast(Condition);
+#endif
+}
+
+
+/*
+    @brief: the loop of a worker thread: takes the next task of the current batch, runs it, and
+        sleeps whenever no task is left, until the pool stops
+
+    @param: parameter - pointer to the thread pool
+
+    @return: 0 once the pool stops
+*/
+#ifdef _WIN32
+DWORD WINAPI runWorker(LPVOID parameter) {
+#else
+void *runWorker(void *parameter) {
+#endif
+    struct ThreadPool *Pool = parameter;
+    int index;
+
+    acquireLock(&Pool->lock);
+
+    while (!Pool->isStopping) {
+        if (Pool->nextTask >= Pool->numTasks) {
+            waitCondition(&Pool->hasWork, &Pool->lock);
+            continue;
+        }
+
+        index = Pool->nextTask++;
+        releaseLock(&Pool->lock);
+
+        Pool->task(Pool->context, index);
+
+        acquireLock(&Pool->lock);
+        if (++Pool->numFinished == Pool->numTasks) signalCondition(&Pool->isIdle);
+    }
+
+    releaseLock(&Pool->lock);
+    return 0;
+}
+
+
+/*
+    @brief: starts a worker thread of a pool
+
+    @param: Thread - pointer to where the thread is kept
+    @param: Pool - pointer to the pool the thread works for
+
+    @return: 1 - the thread was started
+             0 - the thread could not be created
+*/
+int startWorker(threadHandle *Thread, struct ThreadPool *Pool) {
+#ifdef _WIN32
+    *Thread = CreateThread(NULL, 0, runWorker, Pool, 0, NULL);
+    return *Thread != NULL;
+#else
+    return pthread_create(Thread, NULL, runWorker, Pool) == 0;
+#endif
+}
+
+
+/*
+    @brief: waits for a thread to exit and releases it
+
+    @param: Thread - the thread
+*/
+void joinThread(threadHandle Thread) {
+#ifdef _WIN32
+    WaitForSingleObject(Thread, INFINITE);
+    CloseHandle(Thread);
+#else
+    pthread_join(Thread, NULL);
+#endif
+}
+
+
+/*
+    @brief: starts the worker threads of a pool. If a thread cannot be created, the pool keeps the
+        ones started so far, down to none.
+
+    @param: Pool - pointer to the pool being initialized
+    @param: numThreads - number of worker threads wanted, besides the threads that start batches
+*/
+void initializeThreadPool(struct ThreadPool *Pool, int numThreads) {
+    int i;
+
+    initializeLock(&Pool->lock);
+    initializeCondition(&Pool->hasWork);
+    initializeCondition(&Pool->isIdle);
+
+    Pool->task = NULL;
+    Pool->context = NULL;
+    Pool->numTasks = 0;
+    Pool->nextTask = 0;
+    Pool->numFinished = 0;
+    Pool->isStopping = 0;
+
+    Pool->threads = numThreads > 0 ? malloc(numThreads * sizeof(threadHandle)) : NULL;
+    Pool->numThreads = 0;
+
+    for (i = 0; Pool->threads != NULL && i < numThreads; i++) {
+        if (!startWorker(&Pool->threads[i], Pool)) break;
+
+        Pool->numThreads++;
+    }
+}
+
+
+/*
+    @brief: stops the worker threads of a pool and waits for them to exit
+
+    @param: Pool - pointer to the pool being freed
+
+    Precondition: no batch is running.
+*/
+void freeThreadPool(struct ThreadPool *Pool) {
+    int i;
+
+    acquireLock(&Pool->lock);
+    Pool->isStopping = 1;
+    signalCondition(&Pool->hasWork);
+    releaseLock(&Pool->lock);
+
+    for (i = 0; i < Pool->numThreads; i++) joinThread(Pool->threads[i]);
+
+    free(Pool->threads);
+    Pool->threads = NULL;
+    Pool->numThreads = 0;
+    freeCondition(&Pool->hasWork);
+    freeCondition(&Pool->isIdle);
+    freeLock(&Pool->lock);
+}
+
+
+/*
+    @brief: runs task(context, index) for every index from 0 to numTasks - 1, spread over the
+        pool's threads and the calling thread, and returns once all of them are finished
+
+    @param: Pool - pointer to the pool; NULL runs every task on the calling thread
+    @param: task - the function run for each index
+    @param: context - passed to every call of task
+    @param: numTasks - number of tasks
+
+    Precondition: only one thread starts batches on a pool.
+*/
+void runTasks(struct ThreadPool *Pool, void (*task)(void *context, int index), void *context, int numTasks) {
+    int index;
+
+    if (Pool == NULL || Pool->numThreads == 0 || numTasks < 2) {
+        for (index = 0; index < numTasks; index++) task(context, index);
+        return;
+    }
+
+    acquireLock(&Pool->lock);
+
+    Pool->task = task;
+    Pool->context = context;
+    Pool->numTasks = numTasks;
+    Pool->nextTask = 0;
+    Pool->numFinished = 0;
+    signalCondition(&Pool->hasWork);
+
+    while (Pool->nextTask < Pool->numTasks) { // the calling thread works too
+        index = Pool->nextTask++;
+        releaseLock(&Pool->lock);
+
+        task(context, index);
+
+        acquireLock(&Pool->lock);
+        Pool->numFinished++;
+    }
+
+    while (Pool->numFinished < Pool->numTasks) {
+        waitCondition(&Pool->isIdle, &Pool->lock);
+    }
+
+    releaseLock(&Pool->lock);
+}
+
+
+/*
+    @brief: writes the time since the game started into the clock's field, then puts the console's
+        cursor back where it was. The cursor is saved here rather than left to the frame's saved
+        position, since what the player types at a prompt moves it past the end of the footer.
+        Between frames the two are the same, so the frame's partial updates still return there.
+
+    @param: Timer - pointer to the timer
+
+    Precondition: the calling thread holds the timer's lock, and the field is shown.
+*/
+void writeLiveTimer(struct LiveTimer *Timer) {
+    char text[64];
+    long long tenths = (getMicroseconds() - Timer->startMicroseconds) / 100000;
+    int length;
+
+    length = snprintf(text, sizeof(text), "\x1b" "7\x1b[%d;%dH%lld:%02lld.%lld\x1b" "8", Timer->row,
+        Timer->column, tenths / 600, tenths / 10 % 60, tenths % 10);
+    writeConsole(text, length);
+}
+
+
+/*
+    @brief: the loop of a timer's thread: rewrites the clock at every tick while it is shown, until
+        the timer stops
+
+    @param: parameter - pointer to the timer
+
+    @return: 0 once the timer stops
+*/
+#ifdef _WIN32
+DWORD WINAPI runLiveTimer(LPVOID parameter) {
+#else
+void *runLiveTimer(void *parameter) {
+#endif
+    struct LiveTimer *Timer = parameter;
+    long long elapsed;
+
+    acquireLock(&Timer->lock);
+
+    while (!Timer->isStopping) {
+        if (Timer->isShown) writeLiveTimer(Timer);
+
+        // sleeps until the next tick of the clock, so the field changes when the time does
+        elapsed = (getMicroseconds() - Timer->startMicroseconds) / 1000;
+        waitConditionFor(&Timer->wakeup, &Timer->lock, LIVE_TIMER_TICK - elapsed % LIVE_TIMER_TICK);
+    }
+
+    releaseLock(&Timer->lock);
+    return 0;
+}
+
+
+/*
+    @brief: prepares a game's clock and starts its thread; the clock is not shown until the first
+        frame is drawn with renderTimedFrame. Nothing is started in batch sessions.
+
+    @param: Timer - pointer to the timer being initialized
+    @param: startMicroseconds - when the game started, from getMicroseconds
+*/
+void initializeLiveTimer(struct LiveTimer *Timer, long long startMicroseconds) {
+    initializeLock(&Timer->lock);
+    initializeCondition(&Timer->wakeup);
+    Timer->startMicroseconds = startMicroseconds;
+    Timer->row = 0;
+    Timer->column = 0;
+    Timer->isShown = 0;
+    Timer->isStopping = 0;
+
+#ifdef _WIN32
+    Timer->thread = isBatch ? NULL : CreateThread(NULL, 0, runLiveTimer, Timer, 0, NULL);
+    Timer->isStarted = Timer->thread != NULL;
+#else
+    Timer->isStarted = !isBatch && pthread_create(&Timer->thread, NULL, runLiveTimer, Timer) == 0;
+#endif
+}
+
+
+/*
+    @brief: stops a game's clock and releases its thread
+
+    @param: Timer - pointer to the timer
+*/
+void freeLiveTimer(struct LiveTimer *Timer) {
+    acquireLock(&Timer->lock);
+    Timer->isShown = 0;
+    Timer->isStopping = 1;
+    signalCondition(&Timer->wakeup);
+    releaseLock(&Timer->lock);
+
+    if (Timer->isStarted) joinThread(Timer->thread);
+    Timer->isStarted = 0;
+
+    freeCondition(&Timer->wakeup);
+    freeLock(&Timer->lock);
+}
+
+
+/*
+    @brief: keeps a game's clock from being written until the next frame is drawn, so that other
+        text can be printed over the frame
+
+    @param: Timer - pointer to the timer
+*/
+void hideLiveTimer(struct LiveTimer *Timer) {
+    acquireLock(&Timer->lock);
+    Timer->isShown = 0;
+    releaseLock(&Timer->lock);
+}
+
+
+/*
+    @brief: draws a frame of a game as renderFrame does, with the game's clock after the header.
+        The clock's field is placed and written only when the frame is drawn in full; otherwise
+        it is already on the screen, and moving the cursor costs nothing more.
+
+    @param: Timer - pointer to the game's timer
+    @param: Frame - pointer to the frame last drawn
+    @param: Board - pointer to the game board
+    @param: currRow - the row of the cursor ( > < )
+    @param: currColumn - the column of the cursor ( > < )
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @param: header - text printed between the title and the board, ending with LIVE_TIMER_LABEL
+    @param: footer - text printed under the board; the console's cursor is left at its end
+*/
+void renderTimedFrame(struct LiveTimer *Timer, struct Frame *Frame, struct Board *Board, int currRow,
+    int currColumn, int theme, char header[], char footer[]) {
+    char *lastLine = strrchr(header, '\n');
+    int isFull;
+
+    acquireLock(&Timer->lock);
+
+    isFull = renderFrame(Frame, Board, currRow, currColumn, theme, header, footer);
+    if (isFull) { // the header follows the title, which leaves the console's cursor at the start of a line
+        Timer->row = EVADE_LINES + 1 + countLines(header);
+        Timer->column = strlen(lastLine != NULL ? lastLine + 1 : header) + 1;
+    }
+
+    if (Timer->isStarted && (isFull || !Timer->isShown)) {
+        Timer->isShown = 1;
+        writeLiveTimer(Timer);
+    }
+
+    releaseLock(&Timer->lock);
+}
+
+
+/*
+    @brief: prepares an empty probability map; the map holds no buffers until it is given a board
+
+    @param: Map - pointer to the map being initialized
+*/
+void initializeProbabilityMap(struct ProbabilityMap *Map) {
+    Map->capacity = 0;
+    Map->mineChance = NULL;
+    Map->isExact = 1;
+
+    Map->components = NULL;
+    Map->numComponents = 0;
+    Map->componentCapacity = 0;
+
+    Map->convolution = NULL;
+    Map->scratch = NULL;
+    Map->interiorWeights = NULL;
+    Map->weightCapacity = 0;
+}
+
+
+/*
+    @brief: releases the buffers of a probability map and of its components
+
+    @param: Map - pointer to the map being freed
+*/
+void freeProbabilityMap(struct ProbabilityMap *Map) {
+    int i;
+
+    for (i = 0; i < Map->componentCapacity; i++) {
+        free(Map->components[i].cells);
+        free(Map->components[i].constraints);
+        free(Map->components[i].placements);
+        free(Map->components[i].mineWeights);
+    }
+
+    free(Map->mineChance);
+    free(Map->components);
+    free(Map->convolution);
+    free(Map->scratch);
+    free(Map->interiorWeights);
+    initializeProbabilityMap(Map);
+}
+
+
+/*
+    @brief: adds an empty component to a probability map, growing the component list when full.
+        Components keep their buffers when the map is reused, so they are only grown.
+
+    @param: Map - pointer to the map
+    @param: numCells - number of cells of the component
+    @param: numConstraints - number of constraints of the component
+
+    @return: pointer to the component; NULL if there was not enough memory
+*/
+struct Component *addComponent(struct ProbabilityMap *Map, int numCells, int numConstraints) {
+    int i;
+    int newCapacity;
+    struct Component *newComponents;
+    struct Component *Component;
+    void *newBuffer;
+
+    if (Map->numComponents == Map->componentCapacity) {
+        newCapacity = Map->componentCapacity == 0 ? 64 : Map->componentCapacity * 2;
+        newComponents = realloc(Map->components, newCapacity * sizeof(struct Component));
+        if (newComponents == NULL) return NULL;
+
+        for (i = Map->componentCapacity; i < newCapacity; i++) {
+            newComponents[i].cells = NULL;
+            newComponents[i].cellCapacity = 0;
+            newComponents[i].constraints = NULL;
+            newComponents[i].constraintCapacity = 0;
+            newComponents[i].placements = NULL;
+            newComponents[i].mineWeights = NULL;
+            newComponents[i].weightCapacity = 0;
+        }
+
+        Map->components = newComponents;
+        Map->componentCapacity = newCapacity;
+    }
+
+    Component = &Map->components[Map->numComponents];
+
+    if (numCells > Component->cellCapacity) {
+        newBuffer = realloc(Component->cells, numCells * sizeof(struct ComponentCell));
+        if (newBuffer == NULL) return NULL;
+        Component->cells = newBuffer;
+        Component->cellCapacity = numCells;
+    }
+
+    if (numConstraints > Component->constraintCapacity) {
+        newBuffer = realloc(Component->constraints, numConstraints * sizeof(struct ComponentConstraint));
+        if (newBuffer == NULL) return NULL;
+        Component->constraints = newBuffer;
+        Component->constraintCapacity = numConstraints;
+    }
+
+    if (numCells > Component->weightCapacity) {
+        newBuffer = realloc(Component->placements, (numCells + 1) * sizeof(double));
+        if (newBuffer == NULL) return NULL;
+        Component->placements = newBuffer;
+
+        newBuffer = realloc(Component->mineWeights, (size_t) numCells * (numCells + 1) * sizeof(double));
+        if (newBuffer == NULL) return NULL;
+        Component->mineWeights = newBuffer;
+
+        Component->weightCapacity = numCells;
+    }
+
+    Component->numCells = numCells;
+    Component->numConstraints = numConstraints;
+    seedRandom(&Component->Random, Map->numComponents);
+
+    Map->numComponents++;
+    return Component;
+}
+
+
+/*
+    @brief: copies every frontier component left in a solver after a solve into a probability map
+
+    @param: Board - pointer to the board that was solved
+    @param: Solver - pointer to the solver, holding the constraints left by solvePosition
+    @param: Map - pointer to the probability map
+
+    @return: 1 - components were copied
+             0 - not enough memory
+*/
+int buildComponents(struct Board *Board, struct Solver *Solver, struct ProbabilityMap *Map) {
+    int i, j, k;
+    int numFound;
+    int slot;
+    struct Constraint *Constraint;
+    struct ComponentConstraint *Local;
+    struct Component *Component;
+
+    Map->numComponents = 0;
+    Solver->numComponents = 0;
+
+    for (i = 0; i < Solver->numConstraints; i++) {
+        Solver->constraints[i].component = -1;
+    }
+
+    for (i = 0; i < Solver->numConstraints; i++) {
+        if (Solver->constraints[i].numCells == 0 || Solver->constraints[i].component >= 0) continue;
+
+        numFound = collectComponent(Board, Solver, i);
+        Component = addComponent(Map, Solver->numComponentCells, numFound);
+
+        if (Component != NULL) {
+            for (j = 0; j < Component->numCells; j++) {
+                Component->cells[j].tile = Solver->componentCells[j];
+                Component->cells[j].numConstraints = 0;
+            }
+
+            for (j = 0; j < numFound; j++) {
+                Constraint = &Solver->constraints[Solver->queue[j]];
+                Local = &Component->constraints[j];
+                Local->numSlots = Constraint->numCells;
+                Local->numMines = Constraint->numMines;
+
+                for (k = 0; k < Constraint->numCells; k++) {
+                    slot = Solver->slotOfTile[Constraint->cells[k]];
+                    Local->slots[k] = slot;
+                    Component->cells[slot].constraints[Component->cells[slot].numConstraints++] = j;
+                }
+            }
+        }
+
+        for (j = 0; j < Solver->numComponentCells; j++) {
+            Solver->slotOfTile[Solver->componentCells[j]] = -1;
+        }
+
+        if (Component == NULL) return 0;
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: gives a cell of a component a value, updating the constraints it appears in
+
+    @param: Component - pointer to the component
+    @param: slot - position of the cell
+    @param: value - 1 for a mine, 0 for safe
+
+    @return: 1 - every constraint of the cell can still be met
+             0 - a constraint can no longer be met
+*/
+int assignComponentCell(struct Component *Component, int slot, int value) {
+    int i;
+    int isPossible = 1;
+    struct ComponentCell *Cell = &Component->cells[slot];
+    struct ComponentConstraint *Constraint;
+
+    Cell->isMine = value;
+    Component->numPlaced += value;
+
+    for (i = 0; i < Cell->numConstraints; i++) {
+        Constraint = &Component->constraints[Cell->constraints[i]];
+        Constraint->numAssigned++;
+        Constraint->numAssignedMines += value;
+
+        if (Constraint->numAssignedMines > Constraint->numMines ||
+            Constraint->numAssignedMines + Constraint->numSlots - Constraint->numAssigned < Constraint->numMines) {
+            isPossible = 0;
+        }
+    }
+
+    return isPossible;
+}
+
+
+/*
+    @brief: takes back the value given to a cell by assignComponentCell
+
+    @param: Component - pointer to the component
+    @param: slot - position of the cell
+*/
+void unassignComponentCell(struct Component *Component, int slot) {
+    int i;
+    struct ComponentCell *Cell = &Component->cells[slot];
+    struct ComponentConstraint *Constraint;
+
+    for (i = 0; i < Cell->numConstraints; i++) {
+        Constraint = &Component->constraints[Cell->constraints[i]];
+        Constraint->numAssigned--;
+        Constraint->numAssignedMines -= Cell->isMine;
+    }
+
+    Component->numPlaced -= Cell->isMine;
+}
+
+
+/*
+    @brief: adds the placement whose cells all have a value to the weights of a component
+
+    @param: Component - pointer to the component
+*/
+void addPlacement(struct Component *Component) {
+    int j;
+    int numMines = Component->numPlaced;
+    int stride = Component->numCells + 1;
+
+    Component->placements[numMines] += 1;
+
+    for (j = 0; j < Component->numCells; j++) {
+        if (Component->cells[j].isMine) Component->mineWeights[j * stride + numMines] += 1;
+    }
+}
+
+
+/*
+    @brief: enumerates every placement of mines in a component from a cell onwards, dropping a
+        value as soon as a constraint can no longer be met. Stops once the component has used up
+        PROBABILITY_MAX_STEPS steps.
+
+    @param: Component - pointer to the component
+    @param: slot - position of the next cell to give a value
+*/
+void countPlacements(struct Component *Component, int slot) {
+    int value;
+
+    if (Component->numSteps++ > PROBABILITY_MAX_STEPS) return;
+
+    if (slot == Component->numCells) {
+        addPlacement(Component);
+        return;
+    }
+
+    for (value = 0; value <= 1; value++) {
+        if (assignComponentCell(Component, slot, value)) countPlacements(Component, slot + 1);
+        unassignComponentCell(Component, slot);
+    }
+}
+
+
+/*
+    @brief: looks for one placement of mines in a component from a cell onwards, trying the two
+        values of every cell in random order, and adds the first one found to the weights
+
+    @param: Component - pointer to the component
+    @param: slot - position of the next cell to give a value
+    @param: maxSteps - steps allowed before the search is given up
+
+    @return: 1 - a placement was found
+             0 - the search was given up
+*/
+int samplePlacement(struct Component *Component, int slot, int maxSteps) {
+    int i, value;
+    int first;
+    int isFound = 0;
+
+    if (Component->numSteps++ > maxSteps) return 0;
+
+    if (slot == Component->numCells) {
+        addPlacement(Component);
+        return 1;
+    }
+
+    first = getRandomBelow(&Component->Random, 2);
+
+    for (i = 0; i < 2 && !isFound; i++) {
+        value = first ^ i;
+        if (assignComponentCell(Component, slot, value)) isFound = samplePlacement(Component, slot + 1, maxSteps);
+        unassignComponentCell(Component, slot);
+    }
+
+    return isFound;
+}
+
+
+/*
+    @brief: computes the placement weights of one component of a probability map. Components are
+        enumerated exactly; one that runs out of steps is instead sampled with randomized searches
+        for PROBABILITY_SAMPLE_TIME microseconds, which only approximates its weights. Runs as a
+        task of a thread pool: it only touches its own component.
+
+    @param: context - pointer to the probability map
+    @param: index - index of the component
+*/
+void weighComponent(void *context, int index) {
+    struct ProbabilityMap *Map = context;
+    struct Component *Component = &Map->components[index];
+    int i;
+    int numWeights = Component->numCells + 1;
+    double largest = 0;
+    long long startTime;
+
+    for (i = 0; i < Component->numConstraints; i++) {
+        Component->constraints[i].numAssigned = 0;
+        Component->constraints[i].numAssignedMines = 0;
+    }
+
+    memset(Component->placements, 0, numWeights * sizeof(double));
+    memset(Component->mineWeights, 0, (size_t) Component->numCells * numWeights * sizeof(double));
+    Component->numPlaced = 0;
+    Component->numSteps = 0;
+    Component->isExact = 1;
+
+    countPlacements(Component, 0);
+
+    if (Component->numSteps > PROBABILITY_MAX_STEPS) { // too large to enumerate; sample instead
+        Component->isExact = 0;
+        memset(Component->placements, 0, numWeights * sizeof(double));
+        memset(Component->mineWeights, 0, (size_t) Component->numCells * numWeights * sizeof(double));
+
+        startTime = getMicroseconds();
+        while (getMicroseconds() - startTime < PROBABILITY_SAMPLE_TIME) {
+            Component->numSteps = 0;
+            samplePlacement(Component, 0, 16 * Component->numCells);
+        }
+    }
+
+    // scale the weights so that products over many components stay in range
+    for (i = 0; i < numWeights; i++) {
+        if (Component->placements[i] > largest) largest = Component->placements[i];
+    }
+
+    for (i = 0; largest > 0 && i < numWeights; i++) {
+        Component->placements[i] /= largest;
+    }
+    for (i = 0; largest > 0 && i < Component->numCells * numWeights; i++) {
+        Component->mineWeights[i] /= largest;
+    }
+}
+
+
+/*
+    @brief: multiplies the weights of a number of frontier mines by those of one more component:
+        result[m] becomes the sum of result[m - k] * placements[k]. The result is scaled so its
+        largest weight is 1.
+
+    @param: result - weights by number of mines, updated in place
+    @param: numResult - largest number of mines in result
+    @param: Component - pointer to the component
+    @param: scratch - buffer as long as the new result
+
+    @return: largest number of mines in the new result
+*/
+int convolveWeights(double result[], int numResult, struct Component *Component, double scratch[]) {
+    int m, k;
+    int numNew = numResult + Component->numCells;
+    double largest = 0;
+
+    for (m = 0; m <= numNew; m++) {
+        scratch[m] = 0;
+    }
+
+    for (m = 0; m <= numResult; m++) {
+        if (result[m] == 0) continue;
+
+        for (k = 0; k <= Component->numCells; k++) {
+            scratch[m + k] += result[m] * Component->placements[k];
+        }
+    }
+
+    for (m = 0; m <= numNew; m++) {
+        if (scratch[m] > largest) largest = scratch[m];
+    }
+
+    for (m = 0; m <= numNew; m++) {
+        result[m] = largest > 0 ? scratch[m] / largest : 0;
+    }
+
+    return numNew;
+}
+
+
+/*
+    @brief: computes the chance that each tile of a position is a mine, from what the player can
+        see; flags are ignored. Tiles the solver settles get 0 or 1. The rest of the frontier is
+        split into independent components whose placements are weighed by number of mines, on the
+        pool's threads. A placement of the whole frontier with m mines leaves the remaining mines
+        to the interior tiles no number touches, which can hold them in C(interior, remaining - m)
+        ways; these binomials are computed as logarithms of their ratios, since they overflow a
+        double on large boards. Combining both gives exact chances, unless a component had to be sampled.
+
+    @param: Board - pointer to the board of the position
+    @param: Solver - pointer to the solver used to settle the certain tiles
+    @param: Map - pointer to the probability map where the chances are stored
+    @param: Pool - pointer to the thread pool the components are weighed on; NULL for none
+
+    @return: 1 - chances were computed
+             0 - no placement of mines agrees with the position, or not enough memory
+*/
+int computeProbabilities(struct Board *Board, struct Solver *Solver, struct ProbabilityMap *Map,
+    struct ThreadPool *Pool) {
+    int i, j, k, m;
+    int numTiles = Board->rows * Board->columns;
+    int numWords = getNumWords(Board);
+    int numFrontier = 0;
+    int numRest;
+    int numHidden = numTiles;
+    int numKnownMines = 0, numKnownSafe = 0;
+    int numInterior, numMinesLeft;
+    int firstPossible, lastPossible;
+    double logWeight, largestLog = 0;
+    double total, interiorChance, cellWeight;
+    double *newBuffer;
+    struct Component *Component;
+
+    if (numTiles > Map->capacity) {
+        newBuffer = realloc(Map->mineChance, numTiles * sizeof(double));
+        if (newBuffer == NULL) return 0;
+
+        Map->mineChance = newBuffer;
+        Map->capacity = numTiles;
+    }
+
+    if (solvePosition(Board, Solver, 0) < 0 || Solver->capacity == 0) return 0;
+    if (!buildComponents(Board, Solver, Map)) return 0;
+
+    runTasks(Pool, weighComponent, Map, Map->numComponents);
+
+    Map->isExact = 1;
+    for (i = 0; i < Map->numComponents; i++) {
+        numFrontier += Map->components[i].numCells;
+        Map->isExact &= Map->components[i].isExact;
+    }
+
+    if (numFrontier + 1 > Map->weightCapacity) {
+        free(Map->convolution);
+        free(Map->scratch);
+        free(Map->interiorWeights);
+
+        Map->convolution = malloc((numFrontier + 1) * sizeof(double));
+        Map->scratch = malloc((numFrontier + 1) * sizeof(double));
+        Map->interiorWeights = malloc((numFrontier + 1) * sizeof(double));
+        Map->weightCapacity = numFrontier + 1;
+
+        if (Map->convolution == NULL || Map->scratch == NULL || Map->interiorWeights == NULL) {
+            freeProbabilityMap(Map);
+            return 0;
+        }
+    }
+
+    for (i = 0; i < numWords; i++) {
+        numHidden -= __builtin_popcountll(Board->revealedPlane[i]);
+        numKnownMines += __builtin_popcountll(Solver->minePlane[i]);
+        numKnownSafe += __builtin_popcountll(Solver->safePlane[i]);
+    }
+
+    numInterior = numHidden - numKnownMines - numKnownSafe - numFrontier;
+    numMinesLeft = Board->Mines.numMines - numKnownMines;
+
+    // ways to put the mines the frontier leaves into the interior, as logarithms relative to the
+    // fewest frontier mines possible; with r = remaining - m, C(n, r) = C(n, r + 1) * (r + 1) / (n - r)
+    firstPossible = numMinesLeft - numInterior > 0 ? numMinesLeft - numInterior : 0;
+    lastPossible = numMinesLeft < numFrontier ? numMinesLeft : numFrontier;
+    logWeight = 0;
+
+    for (m = firstPossible; m <= lastPossible; m++) {
+        if (m > firstPossible) logWeight += log((numMinesLeft - m + 1.0) / (numInterior - numMinesLeft + m));
+
+        Map->interiorWeights[m] = logWeight;
+        if (m == firstPossible || logWeight > largestLog) largestLog = logWeight;
+    }
+
+    for (m = 0; m <= numFrontier; m++) {
+        Map->interiorWeights[m] = m < firstPossible || m > lastPossible ? 0 :
+            exp(Map->interiorWeights[m] - largestLog);
+    }
+
+    // the interior: every placement of the whole frontier, weighed by the ways left for the interior
+    Map->convolution[0] = 1;
+    numRest = 0;
+
+    for (i = 0; i < Map->numComponents; i++) {
+        numRest = convolveWeights(Map->convolution, numRest, &Map->components[i], Map->scratch);
+    }
+
+    total = 0;
+    interiorChance = 0;
+
+    for (m = 0; m <= numRest; m++) {
+        total += Map->convolution[m] * Map->interiorWeights[m];
+        if (numInterior > 0) {
+            interiorChance += Map->convolution[m] * Map->interiorWeights[m] * (numMinesLeft - m) / numInterior;
+        }
+    }
+
+    if (total <= 0) return 0;
+
+    for (i = 0; i < numTiles; i++) {
+        if (getBit(Board->revealedPlane, i) || getBit(Solver->safePlane, i)) {
+            Map->mineChance[i] = 0;
+        }
+        else if (getBit(Solver->minePlane, i)) {
+            Map->mineChance[i] = 1;
+        }
+        else {
+            Map->mineChance[i] = interiorChance / total;
+        }
+    }
+
+    // each component: its placements, weighed by every placement of the other components and the
+    // ways left for the interior
+    for (i = 0; i < Map->numComponents; i++) {
+        Component = &Map->components[i];
+
+        Map->convolution[0] = 1;
+        numRest = 0;
+
+        for (j = 0; j < Map->numComponents; j++) {
+            if (j != i) numRest = convolveWeights(Map->convolution, numRest, &Map->components[j], Map->scratch);
+        }
+
+        // scratch[k]: weight of everything else when this component has k mines
+        total = 0;
+
+        for (k = 0; k <= Component->numCells; k++) {
+            Map->scratch[k] = 0;
+
+            for (m = 0; m <= numRest; m++) {
+                Map->scratch[k] += Map->convolution[m] * Map->interiorWeights[k + m];
+            }
+
+            total += Component->placements[k] * Map->scratch[k];
+        }
+
+        if (total <= 0) return 0;
+
+        for (j = 0; j < Component->numCells; j++) {
+            cellWeight = 0;
+
+            for (k = 0; k <= Component->numCells; k++) {
+                cellWeight += Component->mineWeights[j * (Component->numCells + 1) + k] * Map->scratch[k];
+            }
+
+            Map->mineChance[Component->cells[j].tile] = cellWeight / total;
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: finds a hint for the player. A flag on a tile that is certainly safe comes first, then
+        the certainly safe tile closest to the cursor, then the closest certain mine that is not
+        flagged yet. When no tile is certain, the unflagged tile least likely to be a mine is
+        suggested instead. Flags are not trusted, so a wrong flag never leads to a wrong hint.
+
+    @param: Board - pointer to the current game board
+    @param: Solver - pointer to the solver
+    @param: Map - pointer to the probability map used when no tile is certain
+    @param: row - row of the cursor
+    @param: column - column of the cursor
+    @param: hint - where the message for the player is stored
+
+    @return: flat index of the hinted tile; -1 if there is none
+*/
+int getHint(struct Board *Board, struct Solver *Solver, struct ProbabilityMap *Map, int row, int column,
+    string100 hint) {
+    int i, cell;
+    int numTiles = Board->rows * Board->columns;
+    int rank, distance, rowDistance, columnDistance;
+    int best = -1;
+    int bestRank = 3;
+    int bestDistance = 0;
+    int numCells = 0;
+
+    if (solvePosition(Board, Solver, 0) > 0) {
+        numCells = Solver->numSafe + Solver->numMines;
+    }
+
+    for (i = 0; i < numCells; i++) {
+        if (i < Solver->numSafe) {
+            cell = Solver->safeCells[i];
+            rank = getBit(Board->flaggedPlane, cell) ? 0 : 1;
+        }
+        else {
+            cell = Solver->mineCells[i - Solver->numSafe];
+            if (getBit(Board->flaggedPlane, cell)) continue;
+            rank = 2;
+        }
+
+        rowDistance = abs(cell / Board->columns - row);
+        columnDistance = abs(cell % Board->columns - column);
+        distance = rowDistance > columnDistance ? rowDistance : columnDistance;
+
+        if (rank < bestRank || (rank == bestRank && distance < bestDistance)) {
+            best = cell;
+            bestRank = rank;
+            bestDistance = distance;
+        }
+    }
+
+    if (best < 0 && computeProbabilities(Board, Solver, Map, NULL)) { // a guess is needed; find the safest one
+        for (cell = 0; cell < numTiles; cell++) {
+            if (getBit(Board->revealedPlane, cell) || getBit(Board->flaggedPlane, cell)) continue;
+
+            rowDistance = abs(cell / Board->columns - row);
+            columnDistance = abs(cell % Board->columns - column);
+            distance = rowDistance > columnDistance ? rowDistance : columnDistance;
+
+            if (best < 0 || Map->mineChance[cell] < Map->mineChance[best] ||
+                (Map->mineChance[cell] == Map->mineChance[best] && distance < bestDistance)) {
+                best = cell;
+                bestDistance = distance;
+            }
+        }
+
+        if (best >= 0) {
+            snprintf(hint, sizeof(string100), "Hint: no tile is certain; the safest is row %d, column %d (%.1f%% mine).",
+                best / Board->columns + 1, best % Board->columns + 1, 100 * Map->mineChance[best]);
+        }
+    }
+
+    if (best < 0) {
+        strcpy(hint, "Hint: no tile is certain; you will have to guess.");
+    }
+    else if (bestRank < 3) {
+        sprintf(hint, "Hint: the %s at row %d, column %d %s.", bestRank == 0 ? "flag" : "tile",
+            best / Board->columns + 1, best % Board->columns + 1,
+            bestRank == 0 ? "is wrong; that tile is safe" : bestRank == 1 ? "is safe" : "is a mine");
+    }
+
+    return best;
+}
+
+
+/*
+    @brief: generates a classic game after its first inspection: the inspected tile and its
+        neighbors never hold mines, so the game opens there, and boards are generated until one can
+        be won from that opening without guessing. The player's flags are kept.
+
+    @param: Board - pointer to the current game board, cleared to the mode's dimensions
+    @param: Solver - pointer to the solver used to verify the boards
+    @param: numMines - number of mines
+    @param: row - row of the first inspection
+    @param: column - column of the first inspection
+    @param: seed - seed of the game; the same seed, dimensions, and first inspection always give the
+        same board
+    @param: numAttempts - where the number of boards generated is stored
+
+    @return: 1 - the board can be won without guessing
+             0 - no such board was found in NO_GUESS_ATTEMPTS tries, so the last one is kept (its
+                 opening is still safe), or there was not enough memory
+
+    Precondition: numMines leaves at least the 3x3 opening free of mines.
+*/
+int generateNoGuessGame(struct Board *Board, struct Solver *Solver, int numMines, int row, int column,
+    unsigned long long seed, int *numAttempts) {
+    struct Random Random;
+    int rows = Board->rows;
+    int columns = Board->columns;
+    int numWords = getNumWords(Board);
+    int isSolvable = 0;
+
+    *numAttempts = 0;
+    if (!prepareSolver(Solver, Board)) return 0;
+
+    memcpy(Solver->savedFlags, Board->flaggedPlane, numWords * sizeof(bitword));
+    seedRandom(&Random, seed);
+
+    while (!isSolvable && *numAttempts < NO_GUESS_ATTEMPTS) {
+        (*numAttempts)++;
+
+        clearBoard(Board, rows, columns); // same size, so no allocation
+        if (!placeMines(Board, numMines, &Random, row, column)) return 0;
+        initializeTileStates(Board);
+
+        isSolvable = isSolvableFrom(Board, Solver, row, column);
+        resetBoardProgress(Board);
+    }
+
+    memcpy(Board->flaggedPlane, Solver->savedFlags, numWords * sizeof(bitword));
+    return isSolvable;
+}
+
+
+/*
+    @brief: prepares an empty action log; the log holds no buffer until an action is added
+
+    @param: Log - pointer to the log being initialized
+*/
+void initializeActionLog(struct ActionLog *Log) {
+    strcpy(Log->mode, "");
+    strcpy(Log->level, "-");
+    Log->rows = 0;
+    Log->columns = 0;
+    Log->numMines = 0;
+    Log->seed = 0;
+    Log->actions = NULL;
+    Log->numActions = 0;
+    Log->capacity = 0;
+}
+
+
+/*
+    @brief: releases the buffer of an action log
+
+    @param: Log - pointer to the log being freed
+*/
+void freeActionLog(struct ActionLog *Log) {
+    free(Log->actions);
+    initializeActionLog(Log);
+}
+
+
+/*
+    @brief: appends an action to the end of a log, growing the log when it is full
+
+    @param: Log - pointer to the log
+    @param: tile - flat index of the tile acted on
+    @param: type - the action ('I' - inspect, 'F' - flag, 'R' - remove flag, 'Q' - quit)
+    @param: milliseconds - time since the start of the game
+
+    @return: 1 - action was added
+             0 - not enough memory to grow the log
+*/
+int appendAction(struct ActionLog *Log, int tile, char type, int milliseconds) {
+    int newCapacity;
+    struct Action *newActions;
+
+    if (Log->numActions == Log->capacity) {
+        newCapacity = Log->capacity == 0 ? 64 : Log->capacity * 2;
+        newActions = realloc(Log->actions, newCapacity * sizeof(struct Action));
+        if (newActions == NULL) return 0;
+
+        Log->actions = newActions;
+        Log->capacity = newCapacity;
+    }
+
+    Log->actions[Log->numActions].tile = tile;
+    Log->actions[Log->numActions].type = type;
+    Log->actions[Log->numActions].milliseconds = milliseconds;
+    Log->numActions++;
+    return 1;
+}
+
+
+/*
+    @brief: carries out a logged action on a board; the interactive game and the replay engine
+        both go through this function, so a replay follows exactly the same steps. Actions that
+        change tiles are recorded in the undo history, and undo and redo actions are taken from it.
+
+    @param: Board - pointer to the current game board
+    @param: History - pointer to the game's undo history; NULL if the game has no undo
+    @param: Action - pointer to the action
+
+    @return: the flat index of a tile the action changed; -1 if it changed nothing
+
+    Precondition: the action's tile is on the board
+*/
+int applyAction(struct Board *Board, struct UndoHistory *History, struct Action *Action) {
+    int row = Action->tile / Board->columns;
+    int column = Action->tile % Board->columns;
+    int isFlagged = Action->type == 'F';
+
+    if (Action->type == 'Z') {
+        return History != NULL ? undoAction(Board, History) : -1;
+    }
+    if (Action->type == 'Y') {
+        return History != NULL ? redoAction(Board, History) : -1;
+    }
+
+    if (Action->type == 'I') {
+        if (isTileRevealed(Board, row, column)) return -1;
+
+        if (History == NULL) {
+            revealTiles(Board, row, column);
+            return Action->tile;
+        }
+
+        beginUndoEntry(History, 'I');
+        revealRecordedTiles(Board, row, column, History);
+        endUndoEntry(History);
+        return Action->tile;
+    }
+
+    if (Action->type == 'F' || Action->type == 'R') {
+        if (isTileFlagged(Board, row, column) == isFlagged) return -1;
+
+        if (History != NULL) {
+            beginUndoEntry(History, Action->type);
+            recordUndoTile(History, Action->tile);
+            endUndoEntry(History);
+        }
+
+        setTileFlagged(Board, row, column, isFlagged);
+        return Action->tile;
+    }
+
+    return -1;
+}
+
+
+/*
+    @brief: writes an action log to the replay file of a profile, replacing the previous one
+
+    @param: Log - pointer to the log being saved
+    @param: name - name of the profile that played the game
+
+    @return: 1 - log was saved
+             0 - the replay file could not be opened
+*/
+int saveActionLog(struct ActionLog *Log, string20 name) {
+    FILE *fp;
+    int i;
+    string100 directory = PROFILES_FOLDER;
+
+    strcat(directory, name);
+    strcat(directory, REPLAY_SUFFIX);
+
+    fp = fopen(directory, "w");
+    if (fp == NULL) return 0;
+
+    fprintf(fp, "%s\n%s\n", Log->mode, Log->level);
+    fprintf(fp, "%d %d %d %llu\n", Log->rows, Log->columns, Log->numMines, Log->seed);
+    fprintf(fp, "%d\n", Log->numActions);
+
+    for (i = 0; i < Log->numActions; i++) {
+        fprintf(fp, "%d %c %d\n", Log->actions[i].tile, Log->actions[i].type, Log->actions[i].milliseconds);
+    }
+
+    fclose(fp);
+    return 1;
+}
+
+
+/*
+    @brief: reads an action log from a replay file
+
+    @param: Log - pointer to an initialized log; its previous contents are replaced
+    @param: directory - path of the replay file
+
+    @return: 1 - log was loaded
+             0 - the file could not be opened, is malformed, or does not fit in memory
+*/
+int loadActionLog(struct ActionLog *Log, char directory[]) {
+    FILE *fp;
+    int i;
+    int numActions;
+    int tile, milliseconds;
+    char type;
+    int isValid;
+
+    fp = fopen(directory, "r");
+    if (fp == NULL) return 0;
+
+    freeActionLog(Log);
+
+    isValid = fscanf(fp, "%20s %100s", Log->mode, Log->level) == 2 &&
+        fscanf(fp, "%d %d %d %llu", &Log->rows, &Log->columns, &Log->numMines, &Log->seed) == 4 &&
+        fscanf(fp, "%d", &numActions) == 1;
+
+    for (i = 0; isValid && i < numActions; i++) {
+        isValid = fscanf(fp, "%d %c %d", &tile, &type, &milliseconds) == 3 &&
+            appendAction(Log, tile, type, milliseconds);
+    }
+
+    fclose(fp);
+    return isValid;
+}
+
+
+/*
+    @brief: builds the board an action log was played on, before any action: an empty board for
+        a classic game, whose mines are placed at the first inspection, or the custom level the
+        log names
+
+    @param: Board - pointer to the board being built
+    @param: Log - pointer to the action log
+
+    @return: 1 - board was built
+             0 - the level is missing or does not match the log, or there was not enough memory
+*/
+int buildLogBoard(struct Board *Board, struct ActionLog *Log) {
+    FILE *fp;
+    string100 directory;
+    int isValid;
+
+    if (strcmp(Log->level, "-") == 0) return clearBoard(Board, Log->rows, Log->columns);
+
+    strcpy(directory, LEVELS_FOLDER);
+    strcat(directory, Log->level);
+    strcat(directory, ".txt");
+
+    fp = fopen(directory, "r");
+    isValid = fp != NULL && readLevel(Board, fp) && Board->rows == Log->rows &&
+        Board->columns == Log->columns && Board->Mines.numMines == Log->numMines;
+    if (fp != NULL) fclose(fp);
+
+    if (isValid) initializeTileStates(Board);
+    return isValid;
+}
+
+
+/*
+    @brief: plays the actions of a log on the board built by buildLogBoard, exactly as they were
+        taken, until the game ends or the player quits. A classic board is generated from the
+        log's seed at the first inspection.
+
+    @param: Board - pointer to the board
+    @param: Solver - pointer to the solver used for generating a classic board
+    @param: History - pointer to the undo history of the game
+    @param: Log - pointer to the action log
+    @param: isGenerated - pointer to 1 if the board's mines are placed, 0 if not yet; updated
+
+    @return: the number of actions played; fewer than the log has if the game ended early or an
+        action is not on the board
+*/
+int playLogActions(struct Board *Board, struct Solver *Solver, struct UndoHistory *History,
+    struct ActionLog *Log, int *isGenerated) {
+    struct Action *Action;
+    int numTiles = Board->rows * Board->columns;
+    int numAttempts;
+    int i;
+
+    for (i = 0; i < Log->numActions && getGameState(Board) == 0; i++) {
+        Action = &Log->actions[i];
+        if (Action->tile < 0 || Action->tile >= numTiles) break;
+
+        if (!*isGenerated && Action->type == 'I') {
+            generateNoGuessGame(Board, Solver, Log->numMines, Action->tile / Board->columns,
+                Action->tile % Board->columns, Log->seed, &numAttempts);
+            *isGenerated = 1;
+        }
+
+        applyAction(Board, History, Action);
+        if (Action->type == 'Q') return i + 1;
+    }
+
+    return i;
+}
+
+
+/*
+    @brief: forces the journal's buffered actions to disk, so they survive the program or the
+        computer stopping
+
+    @param: Journal - pointer to the journal
+*/
+void syncJournal(struct Journal *Journal) {
+    if (Journal->fp == NULL) return;
+
+    fflush(Journal->fp);
+    syncFile(Journal->fp);
+    Journal->numPending = 0;
+}
+
+
+/*
+    @brief: opens a profile's journal for the game being played, starting it over with the header
+        of the game's log and the actions already in it. A resumed game rewrites the journal it
+        was resumed from instead of appending to it, so a line cut short by the crash is dropped
+        rather than joined to the next action.
+
+    @param: Journal - pointer to the journal
+    @param: Log - pointer to the game's action log, whose header is set
+    @param: name - name of the profile playing the game
+
+    @return: 1 - journal was opened
+             0 - the journal could not be opened; the game can still be played without it
+*/
+int openJournal(struct Journal *Journal, struct ActionLog *Log, string20 name) {
+    string100 directory;
+    int i;
+
+    getJournalDirectory(name, directory);
+    Journal->fp = fopen(directory, "w");
+    Journal->numPending = 0;
+
+    if (Journal->fp == NULL) return 0;
+
+    fprintf(Journal->fp, "%s\n%s\n", Log->mode, Log->level);
+    fprintf(Journal->fp, "%d %d %d %llu\n", Log->rows, Log->columns, Log->numMines, Log->seed);
+
+    for (i = 0; i < Log->numActions; i++) {
+        fprintf(Journal->fp, "%d %c %d\n", Log->actions[i].tile, Log->actions[i].type,
+            Log->actions[i].milliseconds);
+    }
+
+    syncJournal(Journal);
+    return 1;
+}
+
+
+/*
+    @brief: appends an action to the journal, forcing the journal to disk once JOURNAL_BATCH
+        actions are buffered
+
+    @param: Journal - pointer to the journal
+    @param: Action - pointer to the action
+*/
+void appendJournal(struct Journal *Journal, struct Action *Action) {
+    if (Journal->fp == NULL) return;
+
+    fprintf(Journal->fp, "%d %c %d\n", Action->tile, Action->type, Action->milliseconds);
+    Journal->numPending++;
+
+    if (Journal->numPending >= JOURNAL_BATCH) syncJournal(Journal);
+}
+
+
+/*
+    @brief: closes the journal of a game that is over and deletes it, since there is nothing left
+        to resume
+
+    @param: Journal - pointer to the journal
+    @param: name - name of the profile that played the game
+*/
+void closeJournal(struct Journal *Journal, string20 name) {
+    string100 directory;
+
+    if (Journal->fp != NULL) fclose(Journal->fp);
+    Journal->fp = NULL;
+
+    getJournalDirectory(name, directory);
+    remove(directory);
+}
+
+
+/*
+    @brief: reads a profile's journal into an action log. A line cut short by a crash ends the
+        journal, so every action written in full is kept; openJournal then rewrites the journal
+        without it.
+
+    @param: Log - pointer to the log being filled
+    @param: name - name of the profile
+
+    @return: 1 - the profile has a journal of an unfinished game
+             0 - there is no journal, or its header is unreadable
+*/
+int loadJournal(struct ActionLog *Log, string20 name) {
+    FILE *fp;
+    string100 directory;
+    int tile, milliseconds;
+    char type;
+    int isValid;
+
+    getJournalDirectory(name, directory);
+    fp = fopen(directory, "r");
+    if (fp == NULL) return 0;
+
+    freeActionLog(Log);
+
+    isValid = fscanf(fp, "%20s %100s", Log->mode, Log->level) == 2 &&
+        fscanf(fp, "%d %d %d %llu", &Log->rows, &Log->columns, &Log->numMines, &Log->seed) == 4 &&
+        Log->rows > 0 && Log->columns > 0;
+
+    while (isValid && fscanf(fp, "%d %c %d", &tile, &type, &milliseconds) == 3 &&
+        (type == 'I' || type == 'F' || type == 'R' || type == 'Z' || type == 'Y' || type == 'Q')) {
+        if (!appendAction(Log, tile, type, milliseconds)) isValid = 0;
+    }
+
+    fclose(fp);
+    return isValid;
+}
+
+
+/*
+    @brief: uses the binary insertion sort algorithm to sort an array of record times for the
+        leaderboard
+
+    @param: name - name of the potential record setter
+    @param: time - time of the potential record setter
+    @param: names - array of record-setting names for the leaderboard being updated
+    @param: times - array of record-setting times (in seconds) for the leaderboard being updated
+    @param: numRecords - pointer to the number of records currently existing in the leaderboard
+
+    @return: 1 to MAX_RECORDS - the rank of the new record set
+             0 - no new records set
+
+    Precondition: numRecords is less than or equal to MAX_RECORDS. times is arranged in increasing
+        order and names contains names corresponding to the times they set.
+*/
+int updateRecord(string20 name, int time, string20 names[], int times[], int *numRecords) {
+    int i;
+    int index = 0;
+    int high = *numRecords - 1;
+    int mid;
+	
+    while (index <= high) { // determines the index of the first element less than time
+        mid = (index + high) / 2;
+
+        if (times[mid] <= time) {
+            index = mid + 1;
+        }
+        else {
+            high = mid - 1;
+        }
+    }
+
+    if (index == MAX_RECORDS) return -1;
+
+    for (i = MAX_RECORDS - 1; i > index; i--) { // shifts the lower records to the right
+        strcpy(names[i], names[i - 1]);
+        times[i] = times[i - 1];
+    }
+
+    strcpy(names[index], name); // adds the current information as a record
+    times[index] = time;
+
+    if (*numRecords < MAX_RECORDS) (*numRecords)++; // ensures the number of records won't pass MAX_RECORDS
+
+    return index + 1; // the rank of the newly set record; 0 if no record is set
+}
+
+
+/*
+    @brief: updates the leaderboard structure then the text file based on the structure information
+	
+	@param: mode - the recently concluded game's mode
+    @param: outcome - the recently concluded game's outcome
+	@param: name - the player name of the recently concluded game
+	@param: seconds - the recently concluded game's time in seconds
+	@param: CurrentLeaderboard - pointer to the current leaderboard struct that we want to update
+	
+	@return: 0 - game did not set a new record | leaderboard file failed to open
+			 rank - rank of the new record set
+
+    Precondition: LEADERBOARD_DIRECTORY is accurate. rank obtained from updateRecord is accurate.
+*/
+int updateLeaderboard(string20 mode, string20 outcome, string20 name, int seconds, struct Leaderboard *CurrentLeaderboard) {
+    int i;
+    int rank = 0; // expert games are not ranked
+    FILE *fp;
+
+    if (strcmp(outcome, WON_OUTCOME) != 0) return 0;
+
+    struct Records *EasyRecords = &CurrentLeaderboard->EasyRecords;
+    struct Records *DifficultRecords = &CurrentLeaderboard->DifficultRecords;
+    struct Records *CustomRecords = &CurrentLeaderboard->CustomRecords;
+
+    if (strcmp(mode, EASY_MODE) == 0) { // update easy leaderboard
+        rank = updateRecord(name, seconds, EasyRecords->names, EasyRecords->times, &EasyRecords->numRecords);
+    }
+    else if (strcmp(mode, DIFFICULT_MODE) == 0) { // update difficult leaderboard
+        rank = updateRecord(name, seconds, DifficultRecords->names, DifficultRecords->times,
+            &DifficultRecords->numRecords);
+    }
+    else if (strcmp(mode, CUSTOM_MODE) == 0) { // update custom leaderboard
+        rank = updateRecord(name, seconds, CustomRecords->names, CustomRecords->times, &CustomRecords->numRecords);
+    }
+
+    fp = fopen(LEADERBOARD_DIRECTORY, "w");
+    if (fp == NULL) return 0;
+
+    fprintf(fp, "%d\n", EasyRecords->numRecords);
+    for (i = 0; i < EasyRecords->numRecords; i++) {
+        fprintf(fp, "%s %d\n", EasyRecords->names[i], EasyRecords->times[i]);
+    }
+
+    fprintf(fp, "\n%d\n", DifficultRecords->numRecords);
+    for (i = 0; i < DifficultRecords->numRecords; i++) {
+        fprintf(fp, "%s %d\n", DifficultRecords->names[i], DifficultRecords->times[i]);
+    }
+
+    fprintf(fp, "\n%d\n", CustomRecords->numRecords);
+    for (i = 0; i < CustomRecords->numRecords; i++) {
+        fprintf(fp, "%s %d\n", CustomRecords->names[i], CustomRecords->times[i]);
+    }
+
+    fclose(fp);
+    return rank;
+}
+
+
+/*
+    @brief: prepares an empty endless board; no chunk exists until one is touched
+
+    @param: Endless - pointer to the endless board being initialized
+    @param: seed - seed of the game; every chunk's mines are derived from it
+*/
+void initializeEndlessBoard(struct EndlessBoard *Endless, unsigned long long seed) {
+    Endless->seed = seed;
+    Endless->chunks = NULL;
+    Endless->numChunks = 0;
+    Endless->chunkCapacity = 0;
+    Endless->table = NULL;
+    Endless->tableSize = 0;
+    Endless->workStack = NULL;
+    Endless->workCapacity = 0;
+    Endless->numRevealed = 0;
+    Endless->isExploded = 0;
+}
+
+
+/*
+    @brief: releases every chunk and buffer of an endless board
+
+    @param: Endless - pointer to the endless board being freed
+*/
+void freeEndlessBoard(struct EndlessBoard *Endless) {
+    int i;
+
+    for (i = 0; i < Endless->numChunks; i++) {
+        freeBoard(&Endless->chunks[i].Board);
+    }
+
+    free(Endless->chunks);
+    free(Endless->table);
+    free(Endless->workStack);
+    initializeEndlessBoard(Endless, 0);
+}
+
+
+/*
+    @brief: gets the slot of the hash table where the search for a chunk starts
+
+    @param: Endless - pointer to the endless board
+    @param: chunkRow - row of the chunk (its tiles' rows divided by CHUNK_SIZE)
+    @param: chunkColumn - column of the chunk
+
+    @return: the slot
+*/
+int getChunkSlot(struct EndlessBoard *Endless, int chunkRow, int chunkColumn) {
+    unsigned long long key = (unsigned long long) chunkRow << 32 | (unsigned int) chunkColumn;
+
+    return getSplitMix(&key) & (Endless->tableSize - 1);
+}
+
+
+/*
+    @brief: looks up a chunk without generating it
+
+    @param: Endless - pointer to the endless board
+    @param: chunkRow - row of the chunk
+    @param: chunkColumn - column of the chunk
+
+    @return: index of the chunk in Endless->chunks; -1 if the chunk has not been generated
+*/
+int findChunk(struct EndlessBoard *Endless, int chunkRow, int chunkColumn) {
+    int slot;
+    struct Chunk *Chunk;
+
+    if (Endless->tableSize == 0) return -1;
+
+    // linear probing; the table is never more than half full, so an empty slot always ends the search
+    for (slot = getChunkSlot(Endless, chunkRow, chunkColumn); Endless->table[slot] != -1;
+        slot = (slot + 1) & (Endless->tableSize - 1)) {
+        Chunk = &Endless->chunks[Endless->table[slot]];
+
+        if (Chunk->chunkRow == chunkRow && Chunk->chunkColumn == chunkColumn) {
+            return Endless->table[slot];
+        }
+    }
+
+    return -1;
+}
+
+
+/*
+    @brief: doubles the hash table of an endless board and places every chunk again
+
+    @param: Endless - pointer to the endless board
+
+    @return: 1 - table was grown
+             0 - not enough memory (the old table is kept)
+*/
+int growChunkTable(struct EndlessBoard *Endless) {
+    int i, slot;
+    int newSize = Endless->tableSize == 0 ? 64 : Endless->tableSize * 2;
+    int *newTable = malloc(newSize * sizeof(int));
+
+    if (newTable == NULL) return 0;
+
+    free(Endless->table);
+    Endless->table = newTable;
+    Endless->tableSize = newSize;
+
+    for (i = 0; i < newSize; i++) {
+        Endless->table[i] = -1;
+    }
+
+    for (i = 0; i < Endless->numChunks; i++) {
+        slot = getChunkSlot(Endless, Endless->chunks[i].chunkRow, Endless->chunks[i].chunkColumn);
+
+        while (Endless->table[slot] != -1) {
+            slot = (slot + 1) & (newSize - 1);
+        }
+
+        Endless->table[slot] = i;
+    }
+
+    return 1;
+}
+
+
+/*
+    @brief: looks up a chunk, generating its mines first if it has never been touched. Its edge
+        counts are not computed here (see getChunkWithStates).
+
+    @param: Endless - pointer to the endless board
+    @param: chunkRow - row of the chunk
+    @param: chunkColumn - column of the chunk
+
+    @return: index of the chunk in Endless->chunks; -1 if there is not enough memory for it.
+        Generating a chunk may move the others, so earlier pointers into Endless->chunks are stale.
+*/
+int getChunk(struct EndlessBoard *Endless, int chunkRow, int chunkColumn) {
+    int index = findChunk(Endless, chunkRow, chunkColumn);
+    int slot;
+    int newCapacity;
+    struct Chunk *newChunks;
+    struct Chunk *Chunk;
+
+    if (index != -1) return index;
+
+    if ((Endless->numChunks + 1) * 2 > Endless->tableSize && !growChunkTable(Endless)) return -1;
+
+    if (Endless->numChunks == Endless->chunkCapacity) {
+        newCapacity = Endless->chunkCapacity == 0 ? 64 : Endless->chunkCapacity * 2;
+        newChunks = realloc(Endless->chunks, newCapacity * sizeof(struct Chunk));
+        if (newChunks == NULL) return -1;
+
+        Endless->chunks = newChunks;
+        Endless->chunkCapacity = newCapacity;
+    }
+
+    Chunk = &Endless->chunks[Endless->numChunks];
+    Chunk->chunkRow = chunkRow;
+    Chunk->chunkColumn = chunkColumn;
+    Chunk->hasStates = 0;
+    initializeBoard(&Chunk->Board);
+
+    // the chunk's own seed mixes the game's seed with the chunk's coordinates
+    if (!clearBoard(&Chunk->Board, CHUNK_SIZE, CHUNK_SIZE) || !generateClassicGame(&Chunk->Board,
+        CHUNK_MINES, Endless->seed ^ ((unsigned long long) chunkRow << 32 | (unsigned int) chunkColumn))) {
+        freeBoard(&Chunk->Board);
+        return -1;
+    }
+
+    slot = getChunkSlot(Endless, chunkRow, chunkColumn);
+    while (Endless->table[slot] != -1) {
+        slot = (slot + 1) & (Endless->tableSize - 1);
+    }
+
+    Endless->table[slot] = Endless->numChunks;
+    return Endless->numChunks++;
+}
+
+
+/*
+    @brief: looks up a chunk and makes sure every one of its tiles counts all nearby mines,
+        including the mines of the neighboring chunks, which are generated if needed
+
+    @param: Endless - pointer to the endless board
+    @param: chunkRow - row of the chunk
+    @param: chunkColumn - column of the chunk
+
+    @return: index of the chunk in Endless->chunks; -1 if there is not enough memory
+*/
+int getChunkWithStates(struct EndlessBoard *Endless, int chunkRow, int chunkColumn) {
+    int index = getChunk(Endless, chunkRow, chunkColumn);
+    int neighbors[3][3];
+    int neighbor;
+    int i, j, k, l;
+    int row, column;
+    struct Board *Board;
+    struct Board *Neighbor;
+
+    if (index == -1 || Endless->chunks[index].hasStates) return index;
+
+    // generate the mines of all 8 neighbors before taking any pointer, since that may move chunks;
+    // there are no chunks, and so no mines, past the edges of the board
+    for (i = 0; i < 3; i++) {
+        for (j = 0; j < 3; j++) {
+            row = chunkRow + i - 1;
+            column = chunkColumn + j - 1;
+            neighbors[i][j] = -1;
+
+            if (row >= 0 && row < ENDLESS_SIZE / CHUNK_SIZE && column >= 0 && column < ENDLESS_SIZE / CHUNK_SIZE) {
+                neighbors[i][j] = getChunk(Endless, row, column);
+                if (neighbors[i][j] == -1) return -1;
+            }
+        }
+    }
+
+    Board = &Endless->chunks[index].Board;
+    initializeTileStates(Board);
+    Endless->chunks[index].hasStates = 1;
+
+    // add the mines across the chunk's edges to the tiles along them
+    for (i = 0; i < CHUNK_SIZE; i++) {
+        for (j = 0; j < CHUNK_SIZE; j++) {
+            if (i > 0 && i < CHUNK_SIZE - 1 && j > 0 && j < CHUNK_SIZE - 1) continue; // not an edge
+            if (getTileState(Board, i, j) == 9) continue;
+
+            for (k = i - 1; k <= i + 1; k++) {
+                for (l = j - 1; l <= j + 1; l++) {
+                    if (k >= 0 && k < CHUNK_SIZE && l >= 0 && l < CHUNK_SIZE) continue; // inside
+
+                    neighbor = neighbors[(k + CHUNK_SIZE) / CHUNK_SIZE][(l + CHUNK_SIZE) / CHUNK_SIZE];
+                    if (neighbor == -1) continue; // past the edge of the board
+
+                    row = (k + CHUNK_SIZE) % CHUNK_SIZE;
+                    column = (l + CHUNK_SIZE) % CHUNK_SIZE;
+                    Neighbor = &Endless->chunks[neighbor].Board;
+
+                    if (hasMine(Neighbor, getTileIndex(Neighbor, row, column))) {
+                        Board->states[getTileIndex(Board, i, j)]++;
+                    }
+                }
+            }
+        }
+    }
+
+    return index;
+}
+
+
+/*
+    @brief: finds the chunk board and local position of a tile of an endless board
+
+    @param: Endless - pointer to the endless board
+    @param: row - row of the tile
+    @param: column - column of the tile
+    @param: needsStates - 1 if the tile's state has to count all nearby mines
+    @param: localRow - where the tile's row within its chunk is stored
+    @param: localColumn - where the tile's column within its chunk is stored
+
+    @return: pointer to the board of the tile's chunk; NULL if there is not enough memory
+*/
+struct Board *getEndlessTile(struct EndlessBoard *Endless, int row, int column, int needsStates,
+    int *localRow, int *localColumn) {
+    int index;
+
+    if (needsStates) {
+        index = getChunkWithStates(Endless, row / CHUNK_SIZE, column / CHUNK_SIZE);
+    }
+    else {
+        index = getChunk(Endless, row / CHUNK_SIZE, column / CHUNK_SIZE);
+    }
+
+    *localRow = row % CHUNK_SIZE;
+    *localColumn = column % CHUNK_SIZE;
+
+    return index == -1 ? NULL : &Endless->chunks[index].Board;
+}
+
+
+/*
+    @brief: pushes a tile onto the work stack of an endless board, growing the stack when it is full
+
+    @param: Endless - pointer to the endless board
+    @param: top - pointer to the number of tiles currently on the stack
+    @param: row - row of the tile
+    @param: column - column of the tile
+
+    @return: 1 - tile was pushed
+             0 - not enough memory to grow the stack
+*/
+int pushEndlessStack(struct EndlessBoard *Endless, int *top, int row, int column) {
+    int newCapacity;
+    int *newStack;
+
+    if (*top + 2 > Endless->workCapacity) {
+        newCapacity = Endless->workCapacity == 0 ? 128 : Endless->workCapacity * 2;
+        newStack = realloc(Endless->workStack, newCapacity * sizeof(int));
+        if (newStack == NULL) return 0;
+
+        Endless->workStack = newStack;
+        Endless->workCapacity = newCapacity;
+    }
+
+    Endless->workStack[(*top)++] = row;
+    Endless->workStack[(*top)++] = column;
+    return 1;
+}
+
+
+/*
+    @brief: reveals a tile of an endless board; continues revealing tiles adjacent to it if it is
+        a blank, across chunk edges, generating chunks as the cascade reaches them
+
+    @param: Endless - pointer to the endless board
+    @param: row - the row of the tile inspected
+    @param: column - the column of the tile inspected
+
+    @return: the number of tiles revealed by this inspection
+*/
+int revealEndlessTiles(struct EndlessBoard *Endless, int row, int column) {
+    int numRevealed = 0;
+    int top = 0;
+    int i, j;
+    int localRow, localColumn;
+    struct Board *Board = getEndlessTile(Endless, row, column, 1, &localRow, &localColumn);
+
+    if (Board == NULL || isTileRevealed(Board, localRow, localColumn)) return 0;
+
+    if (getTileState(Board, localRow, localColumn) == 9) { // a mine; the game is lost
+        setBit(Board->revealedPlane, getTileIndex(Board, localRow, localColumn), 1);
+        Board->states[getTileIndex(Board, localRow, localColumn)] = 10;
+        Endless->isExploded = 1;
+        return 1;
+    }
+
+    setTileRevealed(Board, localRow, localColumn, 1);
+    numRevealed++;
+
+    if (getTileState(Board, localRow, localColumn) == 0) {
+        pushEndlessStack(Endless, &top, row, column);
+    }
+
+    // each blank reveals its neighbors when it is popped; tiles are marked revealed as they are
+    // pushed, so no tile is visited twice
+    while (top > 0) {
+        column = Endless->workStack[--top];
+        row = Endless->workStack[--top];
+
+        for (i = row - 1; i <= row + 1; i++) {
+            for (j = column - 1; j <= column + 1; j++) {
+                if (i < 0 || i >= ENDLESS_SIZE || j < 0 || j >= ENDLESS_SIZE) continue;
+
+                Board = getEndlessTile(Endless, i, j, 1, &localRow, &localColumn);
+                if (Board == NULL || isTileRevealed(Board, localRow, localColumn)) continue;
+
+                setTileRevealed(Board, localRow, localColumn, 1); // tiles touching a blank are never mines
+                numRevealed++;
+
+                if (getTileState(Board, localRow, localColumn) == 0 && !pushEndlessStack(Endless, &top, i, j)) {
+                    Endless->numRevealed += numRevealed;
+                    return numRevealed;
+                }
+            }
+        }
+    }
+
+    Endless->numRevealed += numRevealed;
+    return numRevealed;
+}
+
+
+/*
+    @brief: copies a window of an endless board into an ordinary board so that it can be printed
+        with printBoard. Chunks that have never been touched are shown hidden and are not generated.
+
+    @param: Endless - pointer to the endless board
+    @param: View - pointer to the board receiving the window, already cleared to the window's size
+    @param: originRow - row of the endless board shown in the window's first row
+    @param: originColumn - column of the endless board shown in the window's first column
+    @param: showMines - 1 to reveal the mines in the window (when the game is over)
+*/
+void copyEndlessView(struct EndlessBoard *Endless, struct Board *View, int originRow, int originColumn,
+    int showMines) {
+    int i, j;
+    int index;
+    int viewIndex;
+    struct Board *Board;
+    int row, column;
+
+    for (i = 0; i < View->rows; i++) {
+        for (j = 0; j < View->columns; j++) {
+            index = findChunk(Endless, (originRow + i) / CHUNK_SIZE, (originColumn + j) / CHUNK_SIZE);
+            if (index == -1) continue; // never touched; shown hidden
+
+            Board = &Endless->chunks[index].Board;
+            row = (originRow + i) % CHUNK_SIZE;
+            column = (originColumn + j) % CHUNK_SIZE;
+            viewIndex = getTileIndex(View, i, j);
+
+            View->states[viewIndex] = getTileState(Board, row, column);
+            setBit(View->revealedPlane, viewIndex, isTileRevealed(Board, row, column) ||
+                (showMines && hasMine(Board, getTileIndex(Board, row, column))));
+            setBit(View->flaggedPlane, viewIndex, isTileFlagged(Board, row, column));
+        }
+    }
+}
+
+
+/*
+    @brief: plays an endless game: the board has no edges in practice, the window scrolls with the
+        cursor, and the game goes on until a mine is inspected or the user quits. Endless games are
+        not recorded in the profile or the leaderboard.
+
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void endlessGameHandler(int theme) {
+    char userResponse;
+    int keyValue;
+    int isQuitting = 0;
+    int localRow, localColumn;
+    struct Board *Board;
+
+    struct EndlessBoard Endless;
+    struct Board View;
+    struct Frame Frame;
+    struct LiveTimer Timer;
+    char header[FRAME_TEXT_SIZE];
+
+    // the cursor starts in the middle of the board, so it can travel far in every direction
+    int currRow = ENDLESS_SIZE / 2;
+    int currColumn = ENDLESS_SIZE / 2;
+    int originRow = currRow - ENDLESS_VIEW_ROWS / 2;
+    int originColumn = currColumn - ENDLESS_VIEW_COLUMNS / 2;
+
+    time_t startTime, endTime;
+
+    initializeEndlessBoard(&Endless, getEntropySeed());
+    initializeBoard(&View);
+    initializeFrame(&Frame);
+
+    if (!clearBoard(&View, ENDLESS_VIEW_ROWS, ENDLESS_VIEW_COLUMNS)) return;
+
+    time(&startTime); // start tracking the time
+    initializeLiveTimer(&Timer, getMicroseconds());
+    holdRawInput(1); // keys pressed while a frame is drawn are not echoed onto it
+
+    while (!Endless.isExploded && !isQuitting) {
+        do {
+            clearBoard(&View, ENDLESS_VIEW_ROWS, ENDLESS_VIEW_COLUMNS);
+            copyEndlessView(&Endless, &View, originRow, originColumn, 0);
+
+            // scrolling only rewrites the tiles whose glyph changed
+            snprintf(header, FRAME_TEXT_SIZE, "\n Tiles revealed: %d   Chunks explored: %d   " LIVE_TIMER_LABEL,
+                Endless.numRevealed, Endless.numChunks);
+            renderTimedFrame(&Timer, &Frame, &View, currRow - originRow, currColumn - originColumn, theme, header,
+                "\n Navigate the game board with your arrow keys; it scrolls at the edges.\n\n"
+                " Press 'Enter' to select your action. Press 'Esc' to quit the game.");
+
+            keyValue = detectKeyPress(&currRow, &currColumn, ENDLESS_SIZE, ENDLESS_SIZE);
+
+            if (keyValue == 'L' || keyValue == ESCAPE_VALUE) { // text is printed over the frame
+                hideLiveTimer(&Timer);
+            }
+
+            if (keyValue == 'L') { // the latencies measured so far, on demand
+                printf("\n\n");
+                printLatencyReport();
+                printf("\n Press 'Enter' to return to the game.");
+                holdRawInput(0);
+                clearInputBuffer();
+                holdRawInput(1);
+                Frame.isDrawn = 0;
+            }
+            else if (keyValue != ESCAPE_VALUE) { // the quit prompt would be timed along with the frame
+                markInput(LATENCY_ENDLESS_BOARD);
+            }
+
+            // scroll the window so that the cursor stays inside it
+            if (currRow < originRow) originRow = currRow;
+            if (currRow >= originRow + ENDLESS_VIEW_ROWS) originRow = currRow - ENDLESS_VIEW_ROWS + 1;
+            if (currColumn < originColumn) originColumn = currColumn;
+            if (currColumn >= originColumn + ENDLESS_VIEW_COLUMNS) originColumn = currColumn - ENDLESS_VIEW_COLUMNS + 1;
+
+            if (keyValue == ESCAPE_VALUE) { // user wants to quit
+                printf("\n\n Are you sure you want to quit?\n");
+                Frame.isDrawn = 0;
+                holdRawInput(0);
+
+                if (confirmAction()) { // user confirms quitting
+                    isQuitting = 1;
+                }
+                else {
+                    keyValue = 0;
+                    holdRawInput(1);
+                }
+            }
+        } while (!(keyValue == ENTER_VALUE || keyValue == ESCAPE_VALUE)); // wait for an enter key press
+
+        if (!isQuitting) {
+            holdRawInput(0); // the action is typed as a line
+
+            do {
+                renderTimedFrame(&Timer, &Frame, &View, currRow - originRow, currColumn - originColumn, theme,
+                    header, "\n Inspect [I], Flag [F], Remove Flag [R], or Unselect [U]: ");
+
+                scanf("%c", &userResponse);
+                clearInputBuffer();
+                markInput(LATENCY_ENDLESS_ACTION);
+                Frame.isDrawn = 0; // the answer was echoed under the board
+            } while (!(userResponse == 'I' || userResponse == 'F' || userResponse == 'R' || userResponse == 'U'));
+            holdRawInput(1);
+
+            if (userResponse == 'I') { // user chose to inspect
+                revealEndlessTiles(&Endless, currRow, currColumn);
+            }
+            else if (userResponse == 'F' || userResponse == 'R') { // user chose to flag or remove a flag
+                Board = getEndlessTile(&Endless, currRow, currColumn, 0, &localRow, &localColumn);
+
+                if (Board != NULL) {
+                    setTileFlagged(Board, localRow, localColumn, userResponse == 'F');
+                }
+            }
+        }
+    }
+
+    // post-game processing
+    holdRawInput(0);
+    freeLiveTimer(&Timer);
+    clearScreen();
+    time(&endTime);
+
+    clearBoard(&View, ENDLESS_VIEW_ROWS, ENDLESS_VIEW_COLUMNS);
+    copyEndlessView(&Endless, &View, originRow, originColumn, Endless.isExploded);
+
+    printEvade(theme);
+    printBoard(&View, -1, -1, theme);
+    printf("\n");
+    pace(SHORT_SLEEP);
+
+    if (Endless.isExploded) {
+        printf(" You inspected a mine!");
+    }
+    else {
+        printf(" Game quitted successfully.");
+    }
+
+    pace(LONG_SLEEP);
+    printf("\n\n Tiles revealed: %d", Endless.numRevealed);
+    printf("\n Chunks explored: %d", Endless.numChunks);
+    printf("\n Time: %d seconds", (int) difftime(endTime, startTime));
+
+    countBatchGame(Endless.isExploded ? LOST_OUTCOME : QUIT_OUTCOME);
+    printResult("game mode=%s outcome=%s seconds=%d revealed=%d chunks=%d", ENDLESS_MODE,
+        Endless.isExploded ? LOST_OUTCOME : QUIT_OUTCOME, (int) difftime(endTime, startTime),
+        Endless.numRevealed, Endless.numChunks);
+
+    freeEndlessBoard(&Endless);
+    freeBoard(&View);
+    freeFrame(&Frame);
+
+    pace(LONG_SLEEP);
+    printf("\n\n");
+    pressEnter();
+}
+
+
+/*
+    @brief: Guides the user in game mode selection and game proper. Handles the underlying game
+        generation process.
+	
+	@param: CurrentProfile - pointer to the current profile structure storing current profile
+        information
+	@param: CurrentLeaderboard - pointer to the current leaderboard struct that we want to update
+        after a game has concluded
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+	
+	Precondition: The user chose to begin a game from the main menu.
+*/
+void gameHandler(struct Profile *CurrentProfile, struct Leaderboard *CurrentLeaderboard, int theme) {
+    char userResponse;
+    int keyValue;
+    struct Game *CurrentGame = &CurrentProfile->CurrentGame;
+    struct Board *Board = &CurrentGame->Board;
+
+    int mines = 0;
+    int gameState = 0;
+    int currRow = 0;
+    int currColumn = 0;
+    int isGenerated = 1; // classic boards are only generated at the first inspection
+    int numAttempts;
+    int hintTile;
+    int changedTile;
+    int isResumed = 0;
+    int playedMilliseconds = 0; // time played before the game was resumed
+    string100 hint = ""; // shown under the board until the next action
+    char footer[FRAME_TEXT_SIZE];
+
+    time_t startTime, endTime;
+    long long startMicroseconds;
+    int timeTaken;
+    int rank;
+
+    struct ActionLog Log;
+    struct Action Action;
+    struct Solver Solver;
+    struct ProbabilityMap Map;
+    struct UndoHistory History;
+    struct Journal Journal;
+    struct Frame Frame;
+    struct LiveTimer Timer;
+    initializeActionLog(&Log);
+    initializeSolver(&Solver);
+    initializeProbabilityMap(&Map);
+    initializeUndoHistory(&History);
+    initializeFrame(&Frame);
+    Journal.fp = NULL;
+
+    if (loadJournal(&Log, CurrentProfile->name)) { // a game was cut short; it can be played on from where it stopped
+        clearScreen();
+
+        printf("\n");
+        printDivider();
+        printf("\n");
+
+        printEvade(theme);
+        printf("\n");
+
+        printf(" You have an unfinished %s game. Would you like to resume it?\n", Log.mode);
+
+        if (confirmAction() && buildLogBoard(Board, &Log)) {
+            isGenerated = strcmp(Log.level, "-") != 0;
+            isResumed = playLogActions(Board, &Solver, &History, &Log, &isGenerated) == Log.numActions &&
+                getGameState(Board) == 0 && (Log.numActions == 0 || Log.actions[Log.numActions - 1].type != 'Q');
+        }
+
+        if (isResumed) {
+            strcpy(CurrentGame->mode, Log.mode);
+            mines = Log.numMines;
+
+            if (Log.numActions > 0) { // the cursor starts on the last tile played
+                currRow = Log.actions[Log.numActions - 1].tile / Board->columns;
+                currColumn = Log.actions[Log.numActions - 1].tile % Board->columns;
+                playedMilliseconds = Log.actions[Log.numActions - 1].milliseconds;
+            }
+        }
+        else { // the game is discarded and a new one is started
+            closeJournal(&Journal, CurrentProfile->name);
+            freeActionLog(&Log);
+            clearUndoHistory(&History);
+            isGenerated = 1;
+        }
+    }
+
+    if (!isResumed) {
+        do {
+            clearScreen();
+
+            printf("\n");
+            printDivider();
+            printf("\n");
+		
+			printEvade(theme);
+            printf("\n");
+		
+            printf(" There are three game options:\n\n");
+            printf(" [a] Classic Game\n [b] Custom Game\n [c] Endless Game\n\n");
+
+            printDivider();
+            printf("\n\n");
+
+            printf(" Please input the letter corresponding to your choice (a/b/c): ");
+
+            scanf("%c", &userResponse);
+            clearInputBuffer();
+        } while (!(userResponse >= 'a' && userResponse <= 'c'));
+
+        if (userResponse == 'c') { // Endless Game
+            endlessGameHandler(theme);
+            return;
+        }
+
+        if (userResponse == 'a') { // Classic Game
+            do {
+                clearScreen();
+
+                printf("\n");
+                printDivider();
+                printf("\n");
+            
+                printEvade(theme);
+                printf("\n");
+            
+                printf(" There are three difficulties:\n\n");
+                printf(" [a] Easy\n [b] Difficult\n [c] Expert\n\n");
+
+                printDivider();
+                printf("\n\n");
+
+                printf(" Please input the letter corresponding to your choice (a/b/c): ");
+
+                scanf("%c", &userResponse);
+                clearInputBuffer();
+            } while (!(userResponse >= 'a' && userResponse <= 'c'));
+
+            if (userResponse == 'a') { // easy board
+                strcpy(CurrentGame->mode, EASY_MODE);
+                clearBoard(Board, 8, 8);
+                mines = 10;
+            }
+            else if (userResponse == 'b') { // difficult board
+                strcpy(CurrentGame->mode, DIFFICULT_MODE);
+                clearBoard(Board, 10, 15);
+                mines = 35;
+            }
+            else if (userResponse == 'c') { // expert board
+                strcpy(CurrentGame->mode, EXPERT_MODE);
+                clearBoard(Board, 16, 30);
+                mines = 99;
+            }
+
+            Log.seed = getEntropySeed();
+            isGenerated = 0;
+        }
+        else if (userResponse == 'b') { // Custom Game
+            if (generateCustomGame(Board, Log.level, theme)) {
+                strcpy(CurrentGame->mode, CUSTOM_MODE);
+            }
+            else return;
+
+            initializeTileStates(Board);
+            mines = Board->Mines.numMines;
+        }
+
+        strcpy(Log.mode, CurrentGame->mode);
+        Log.rows = Board->rows;
+        Log.columns = Board->columns;
+        Log.numMines = mines;
+    }
+
+    openJournal(&Journal, &Log, CurrentProfile->name);
+
+    time(&startTime); // start tracking the time, counting the time played before a resume
+    startTime -= playedMilliseconds / 1000;
+    startMicroseconds = getMicroseconds() - playedMilliseconds * 1000LL;
+    initializeLiveTimer(&Timer, startMicroseconds); // the clock goes on from where it was before a resume
+    holdRawInput(1); // keys pressed while a frame is drawn are not echoed onto it
+
+    while (gameState == 0) { // run the game while the user has not yet won/lost/quit
+        do {
+            // only the tiles that changed are drawn again, so moving the cursor is cheap
+            snprintf(footer, FRAME_TEXT_SIZE, "%s%s%s\n Navigate the game board with your arrow keys.\n\n"
+                " Press 'Enter' to select your action. Press 'Esc' to quit the game.",
+                strlen(hint) > 0 ? "\n " : "", hint, strlen(hint) > 0 ? "\n" : "");
+            renderTimedFrame(&Timer, &Frame, Board, currRow, currColumn, theme, "\n " LIVE_TIMER_LABEL, footer);
+
+            keyValue = detectKeyPress(&currRow, &currColumn, Board->rows, Board->columns);
+
+            if (keyValue == 'L' || keyValue == ESCAPE_VALUE) { // text is printed over the frame
+                hideLiveTimer(&Timer);
+            }
+
+            if (keyValue == 'L') { // the latencies measured so far, on demand
+                printf("\n\n");
+                printLatencyReport();
+                printf("\n Press 'Enter' to return to the game.");
+                holdRawInput(0);
+                clearInputBuffer();
+                holdRawInput(1);
+                Frame.isDrawn = 0;
+            }
+            else if (keyValue != ESCAPE_VALUE) { // the quit prompt would be timed along with the frame
+                markInput(LATENCY_GAME_BOARD);
+            }
+
+            if (keyValue == ESCAPE_VALUE) { // user wants to quit
+                printf("\n\n Are you sure you want to quit?\n");
+                Frame.isDrawn = 0;
+                holdRawInput(0);
+                
+                if (confirmAction()) { // user confirms quitting
+                    gameState = 3;
+                    appendAction(&Log, getTileIndex(Board, currRow, currColumn), 'Q',
+                        (getMicroseconds() - startMicroseconds) / 1000);
+                    appendJournal(&Journal, &Log.actions[Log.numActions - 1]);
+                }
+                else {
+                    keyValue = 0;
+                    holdRawInput(1);
+                }
+            }
+        } while (!(keyValue == ENTER_VALUE || keyValue == ESCAPE_VALUE)); // wait for an enter key press
+
+        if (gameState != 3) { // user has not quit
+            holdRawInput(0); // the action is typed as a line
+
+            do {
+                renderTimedFrame(&Timer, &Frame, Board, currRow, currColumn, theme, "\n " LIVE_TIMER_LABEL,
+                    "\n Inspect [I], Flag [F], Remove Flag [R], Undo [Z], Redo [Y], Hint [H], or Unselect [U]: ");
+
+                scanf("%c", &userResponse);
+                clearInputBuffer();
+                markInput(LATENCY_GAME_ACTION);
+                Frame.isDrawn = 0; // the answer was echoed under the board
+            } while (!(userResponse == 'I' || userResponse == 'F' || userResponse == 'R' || userResponse == 'Z' ||
+                userResponse == 'Y' || userResponse == 'H' || userResponse == 'U'));
+            holdRawInput(1);
+
+            if (userResponse == 'H') { // user wants a hint; the cursor moves to the hinted tile
+                if (!isGenerated) {
+                    strcpy(hint, "Hint: every tile is safe for the first inspection.");
+                }
+                else if ((hintTile = getHint(Board, &Solver, &Map, currRow, currColumn, hint)) >= 0) {
+                    currRow = hintTile / Board->columns;
+                    currColumn = hintTile % Board->columns;
+                }
+            }
+            else if (userResponse != 'U') { // user chose to inspect, flag, remove a flag, undo, or redo
+                Action.tile = getTileIndex(Board, currRow, currColumn);
+                Action.type = userResponse;
+                Action.milliseconds = (getMicroseconds() - startMicroseconds) / 1000;
+
+                if (!isGenerated && Action.type == 'I') { // the board is built around the first inspection
+                    generateNoGuessGame(Board, &Solver, mines, currRow, currColumn, Log.seed, &numAttempts);
+                    isGenerated = 1;
+                }
+
+                changedTile = applyAction(Board, &History, &Action);
+                appendAction(&Log, Action.tile, Action.type, Action.milliseconds);
+                appendJournal(&Journal, &Action);
+                strcpy(hint, "");
+
+                if (Action.type == 'Z' || Action.type == 'Y') { // the cursor moves to the tile changed back
+                    if (changedTile >= 0) {
+                        currRow = changedTile / Board->columns;
+                        currColumn = changedTile % Board->columns;
+                    }
+                    else {
+                        strcpy(hint, Action.type == 'Z' ? "There is nothing to undo." : "There is nothing to redo.");
+                    }
+                }
+            }
+
+            gameState = getGameState(Board);
+        }
+    }
+
+    // post-game processing
+    holdRawInput(0);
+    freeLiveTimer(&Timer);
+    clearScreen();
+
+    time(&endTime);
+    timeTaken = difftime(endTime, startTime);
+
+    CurrentGame->exists = 1;
+    CurrentProfile->lifetimeGames++;
+    setMineVisibility(1, Board);
+
+    printEvade(theme);
+    printBoard(Board, -1, -1, theme);
+    printf("\n");
+    pace(SHORT_SLEEP);
+
+    if (gameState == 1) { // user won
+        strcpy(CurrentGame->outcome, WON_OUTCOME);
+
+        printf ("\x1b[1m\x1b[37m %c %c %c%c%c %c %c  %c   %c %c%c%c %c%c%c\x1b[0m\n", 219, 219, 219, 223, 219, 219, 219, 219, 219, 219, 223, 219, 219, 223, 219);
+	  	printf ("\x1b[1m\x1b[32m %c%c%c %c %c %c %c  %c %c %c %c %c %c %c\x1b[0m\n", 223, 219, 223, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219);
+	  	printf ("\x1b[1m\x1b[37m  %c  %c%c%c %c%c%c  %c%c%c%c%c %c%c%c %c %c\x1b[0m\n\n", 219, 219, 220, 219, 219, 220, 219, 219, 220, 223, 220, 219, 219, 220, 219, 219, 219);
+
+        pace(SHORT_SLEEP);
+        printf(" You won!");
+    }
+    else if (gameState == 2) { // user lost
+        strcpy(CurrentGame->outcome, LOST_OUTCOME);
+        
+		printf ("\x1b[1m\x1b[37m %c %c %c%c%c %c %c  %c   %c%c%c %c%c%c %c%c%c\x1b[0m\n", 219, 219, 219, 223, 219, 219, 219, 219, 219, 223, 219, 219, 223, 223, 223, 219, 223);
+	  	printf ("\x1b[1m\x1b[31m %c%c%c %c %c %c %c  %c   %c %c %c%c%c  %c\x1b[0m\n", 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 223, 223, 219, 219);
+	  	printf ("\x1b[1m\x1b[37m  %c  %c%c%c %c%c%c  %c%c%c %c%c%c %c%c%c  %c\x1b[0m\n\n", 219, 219, 220, 219, 219, 220, 219, 219, 220, 220, 219, 220, 219, 220, 220, 219, 219);
+	
+        pace(SHORT_SLEEP);
+        printf(" You inspected a mine!");
+    }
+    else if (gameState == 3) { // user quit
+        strcpy(CurrentGame->outcome, QUIT_OUTCOME);
+
+        setMineVisibility(0, Board);
+        pace(SHORT_SLEEP);
+        printf(" Game quitted successfully.");
+    }
+
+    pace(LONG_SLEEP);
+    printf("\n\n Time: %d seconds", timeTaken);
+    CurrentGame->seconds = timeTaken; // update game time
+
+    // update profile and leaderboard information
+    rank = updateLeaderboard(CurrentGame->mode, CurrentGame->outcome, CurrentProfile->name, CurrentGame->seconds, CurrentLeaderboard);
+
+    if (rank != 0) { // user set a new record
+        pace(LONG_SLEEP);
+        printf("\n\n Congratulations! You set a new #%d record for %s in the all-time leaderboard!", rank, CurrentGame->mode);
+    }
+
+    countBatchGame(CurrentGame->outcome);
+    printResult("game mode=%s level=%s outcome=%s seconds=%d milliseconds=%lld rows=%d columns=%d mines=%d "
+        "actions=%d seed=%llu rank=%d", CurrentGame->mode, Log.level, CurrentGame->outcome, timeTaken,
+        (getMicroseconds() - startMicroseconds) / 1000, Board->rows, Board->columns, mines, Log.numActions,
+        Log.seed, rank);
+
+    updateProfile(CurrentProfile);
+    saveActionLog(&Log, CurrentProfile->name);
+    closeJournal(&Journal, CurrentProfile->name); // the game is over and saved, so it is not resumed
+    freeActionLog(&Log);
+    freeSolver(&Solver);
+    freeProbabilityMap(&Map);
+    freeUndoHistory(&History);
+    freeFrame(&Frame);
+
+    pace(LONG_SLEEP);
+    printf("\n\n");
+    pressEnter();
+}
+
+
+/*
+    @brief: checks if a level created is valid or not
+	
+	@param: Board - pointer to the board of the level being created
+	
+	@return: 0 - level is not valid
+			 1 - level is valid (there is at least 1 mine and 1 non-mine tile)
+*/
+int isValidLevel(struct Board *Board) {
+    return Board->Mines.numMines > 0 && Board->Mines.numMines < Board->rows * Board->columns;
+}
+
+
+/*
+    @brief: guides the user in creating a level; handles the underlying logic and file creation;
+        updates the list of levels
+	
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+	
+	Precondition: LEVELS_DIRECTORY is accurate.
+*/
+void createLevel(int theme) {
+    FILE *fp;
+    FILE *fp2;
+    int i, j;
+    struct Board Board;
+
+    string100 directory;
+    string100 name;
+    char userResponse;
+
+    int numRows, numColumns;
+    int row, column;
+    int isConfirmed;
+    int isValid;
+
+    string100 levels[MAX_LEVELS];
+    int numLevels;
+
+    fp = fopen(LEVELS_DIRECTORY, "r");
+
+    if (fp == NULL) {
+        fp = fopen(LEVELS_DIRECTORY, "w");
+        fprintf(fp, "0\n");
+        fclose(fp);
+
+        createLevel(theme);
+        return;
+    }
+
+    fscanf(fp, "%d", &numLevels);
+
+    if (numLevels >= MAX_LEVELS) {
+        pace(SHORT_SLEEP);
+
+        printf("\nSorry, you cannot create a new level as there can only be a maximum of %d levels.", MAX_LEVELS);
+        pace(LONG_SLEEP);
+
+        printf("\n\n");
+        pressEnter();
+        return;
+    }
+
+    do {
+        pace(SHORT_SLEEP);
+        clearScreen();
+
+        printf("\n");
+        printDivider();
+
+        printLevels(theme);
+
+        printf("\n");
+        printDivider();
+        printf("\n\n");
+
+        printf(" Enter a valid name for the level (or '0' to return to the main menu): ");
+        scanf("%s", name);
+        clearInputBuffer();
+
+        if (strcmp(name, "0") == 0) return;
+
+        strcpy(directory, LEVELS_FOLDER);
+        strcat(directory, name);
+        strcat(directory, ".txt");
+        fp2 = fopen(directory, "r");
+
+        if (fp2 != NULL) { // user provided a name that already exists
+            printf("\n The name '%s' has already been taken!", name);
+            fclose(fp2);
+        }
+    } while (fp2 != NULL);
+
+    fp2 = fopen(directory, "w"); // create the text file
+
+    do {
+        printf("\n Enter the number of rows [5-10]: ");
+        scanf("%d", &numRows);
+        clearInputBuffer();
+    } while (!(numRows >= 5 && numRows <= 10));
+
+    do {
+        printf("\n Enter the number of columns [5-15]: ");
+        scanf("%d", &numColumns);
+        clearInputBuffer();
+    } while (!(numColumns >= 5 && numColumns <= 15));
+
+    fprintf(fp2, "%d %d\n", numRows, numColumns);
+
+    // initialize the board, i.e., the bitplanes of tiles
+    initializeBoard(&Board);
+    clearBoard(&Board, numRows, numColumns);
+
+    do {
+        do {
+            pace(SHORT_SLEEP);
+            clearScreen();
+
+            printEvade(theme);
+            printBoard(&Board, -1, -1, theme);
+            printf("\n Place Mine [P], Delete Mine [D], or Finish Editing [F]: ");
+            scanf("%c", &userResponse);
+            clearInputBuffer();
+        } while (!(userResponse == 'P' || userResponse == 'D' || userResponse == 'F'));
+
+        if (userResponse == 'F') { // user is finished editing
+            printf("\n Are you sure you are finished editing?\n");
+            
+            isConfirmed = confirmAction();
+
+            if (isConfirmed) {
+                isValid = isValidLevel(&Board);
+
+                if (isValid) { // valid level
+                    pace(SHORT_SLEEP);
+
+                    for (i = 0; i < numLevels; i++) {
+                        fscanf(fp, "%s", levels[i]);
+                    }
+                    fclose(fp);
+
+                    fp = fopen(LEVELS_DIRECTORY, "w");
+                    fprintf(fp, "%d\n", numLevels + 1);
+                    for (i = 0; i < numLevels; i++) {
+                        fprintf(fp, "%s\n", levels[i]);
+                    }
+                    fprintf(fp, "%s\n", name);
+                    fclose(fp);
+                }
+                else { // invalid level
+                    printf("\n Error. Please continue editing, as a level should have at least one mine and at least one plain tile.");
+                    pace(LONG_SLEEP);
+                }
+            }
+        }
+        else { // user wants to place or delete a mine
+            do {
+                printf("\n Enter row: ");
+                scanf("%d", &row);
+                clearInputBuffer();
+            } while (!(row >= 1 && row <= numRows));
+
+            do {
+                printf("\n Enter column: ");
+                scanf("%d", &column);
+                clearInputBuffer();
+            } while (!(column >= 1 && column <= numColumns));
+
+            if (userResponse == 'P') {
+                setTileMine(&Board, row - 1, column - 1, 1);
+                setTileRevealed(&Board, row - 1, column - 1, 1);
+            }
+            else if (userResponse == 'D') {
+                setTileMine(&Board, row - 1, column - 1, 0);
+                setTileRevealed(&Board, row - 1, column - 1, 0);
+            }
+        }
+    } while (!isConfirmed || !isValid);
+
+    // post-edit processing
+    for (i = 0; i < numRows; i++) {
+        for (j = 0; j < numColumns; j++) {
+            if (getTileState(&Board, i, j) == 0) {
+                fprintf(fp2, "%c", '.');
+            }
+            else if (getTileState(&Board, i, j) == 9) {
+                fprintf(fp2, "%c", 'X');
+            }
+        }
+        fprintf(fp2, "\n");
+    }
+    fclose(fp2);
+    freeBoard(&Board);
+
+    pace(SHORT_SLEEP);
+    printf("\n Successful.");
+    pace(SHORT_SLEEP);
+
+    printf(" The custom level '%s' has been saved.", name);
+    printResult("level created name=%s rows=%d columns=%d", name, numRows, numColumns);
+    pace(LONG_SLEEP);
+    
+    printf("\n\n");
+    pressEnter();
+}
+
+
+/*
+    @param: guides the user in deleting a level; ensures that the user deletes an actual level;
+	
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void deleteLevel(int theme) {
+    FILE *fp;
+    FILE *fp2;
+    int i;
+
+    string100 directory;
+    string100 name;
+
+    string100 levels[MAX_LEVELS];
+    string100 level;
+    int numLevels;
+
+    fp = fopen(LEVELS_DIRECTORY, "r");
+
+    if (fp == NULL) {
+        fp = fopen(LEVELS_DIRECTORY, "w");
+        fprintf(fp, "0\n");
+        fclose(fp);
+
+        deleteLevel(theme);
+        return;
+    }
+
+    fscanf(fp, "%d", &numLevels);
+
+    do {
+        pace(SHORT_SLEEP);
+        clearScreen();
+        
+        printf("\n");
+        printDivider();
+
+        printLevels(theme);
+
+        printf("\n");
+        printDivider();
+        printf("\n\n");
+
+        printf(" Enter an existing level to delete (or '0' to return to the main menu): ");
+        scanf("%s", name);
+        clearInputBuffer();
+
+        if (strcmp(name, "0") == 0) return;
+
+        strcpy(directory, LEVELS_FOLDER);
+        strcat(directory, name);
+        strcat(directory, ".txt");
+
+        fp2 = fopen(directory, "r");
+        if (fp2 == NULL) {
+            printf("\n The level '%s' does not exist!", name);
+        }
+    } while (fp2 == NULL);
+    
+    fclose(fp2);
+    printf("\n Are you sure you want to delete the level '%s'?\n", name);
+
+    if (confirmAction()) {
+        for (i = 0; i < numLevels; i++) {
+            fscanf(fp, "%s", level);
+            strcpy(levels[i], level);
+        }
+
+        fclose(fp);
+        fp = fopen(LEVELS_DIRECTORY, "w");
+        fprintf(fp, "%d\n", numLevels - 1);
+
+        for (i = 0; i < numLevels; i++) {
+            if (!(strcmp(levels[i], "") == 0 || strcmp(levels[i], name) == 0)) {
+                fprintf(fp, "%s\n", levels[i]);
+            }
+        }
+
+        remove(directory);
+    } else {
+        deleteLevel(theme);
+    }
+
+    pace(SHORT_SLEEP);
+    printf("\n Successful.");
+    pace(SHORT_SLEEP);
+
+    printf(" The custom level '%s' has been deleted from the levels folder.", name);
+    printResult("level deleted name=%s", name);
+    pace(LONG_SLEEP);
+    
+    printf("\n\n");
+    pressEnter();
+    fclose(fp);
+}
+
+
+/*
+    @brief: computes the winrate given the number of games won and lost in a particular mode
+	
+	@param: wins - indicates the total games won in a specific mode
+	@param: losses - indicates the total games lost in a specific mode
+	
+	@return: 0 if no game has been played
+             otherwise, the winrate in float percentage
+
+    Precondition: Assumes wins and losses are from the same game mode.
+*/
+float getWinRate(int wins, int losses) {
+    if (wins + losses == 0) return 0;
+    return (float) wins / (wins + losses) * 100;
+}
+
+
+/*
+    @brief: computes the average time in seconds to win in a particular mode
+	
+	@param: totalSeconds - indicates the total time it took to win across all games in a specific mode
+	@param: gamesWon - indicates the total number of games won the profile has in a specific mode
+	
+	@return: average seconds of the profile in a specific game mode won as int
+
+    Precondition: Assumes totalSeconds and gamesWon are from the same game mode.
+*/
+int getAverageSeconds(int totalSeconds, int gamesWon) {
+    if (gamesWon == 0) return 0;
+    return totalSeconds / gamesWon;
+}
+
+
+/*
+    @brief: prints a player's statistics
+	
+	@param: CurrentProfile - pointer to Profile structure instance containing information to reflect
+        the necessary data on the statistics screen
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+
+    Precondition: Assumes the player's statistics is accurate.
+*/
+void statisticsScreen(struct Profile *CurrentProfile, int theme) {
+    pace(SHORT_SLEEP);
+    clearScreen();
+    
+    printf("\n");
+    printDivider();
+    printf("\n\n");
+
+    printTitle(theme);
+    printf("\n\n");
+
+    printDivider();
+    printf("\n\n\n");
+
+    int month = CurrentProfile->creationDate / 1000000;
+    int day = CurrentProfile->creationDate / 10000 % 100;
+    int year = CurrentProfile->creationDate % 10000;
+
+    float easyWinRate = getWinRate(CurrentProfile->EasyStats.won, CurrentProfile->EasyStats.lost);
+    float difficultWinRate = getWinRate(CurrentProfile->DifficultStats.won, CurrentProfile->DifficultStats.lost);
+    float customWinRate = getWinRate(CurrentProfile->CustomStats.won, CurrentProfile->CustomStats.lost);
+
+    int easyAverageSeconds = getAverageSeconds(CurrentProfile->EasyStats.totalSeconds,
+        CurrentProfile->EasyStats.won);
+    int difficultAverageSeconds = getAverageSeconds(CurrentProfile->DifficultStats.totalSeconds,
+        CurrentProfile->DifficultStats.won);
+    int customAverageSeconds = getAverageSeconds(CurrentProfile->CustomStats.totalSeconds,
+        CurrentProfile->CustomStats.won);
+
+    printf(" -------------------------------------\n");
+    printf(" ----- Basic Profile Information -----\n");
+    printf(" -------------------------------------\n\n");
+
+    printf(" Name: %s\n", CurrentProfile->name);
+    printf(" Date of Profile Creation: %02d/%02d/%d\n", month, day, year);
+    printf(" Lifetime Games Played: %d\n\n\n", CurrentProfile->lifetimeGames);
+
+    printf(" -----------------------------------\n");
+    printf(" ----- Classic Game Statistics -----\n");
+    printf(" -----------------------------------\n\n");
+
+    printf(" Easy Win Rate: %.2f %%\n", easyWinRate);
+    printf(" Easy Games Won Average Time: %d seconds\n", easyAverageSeconds);
+    printf(" Easy Games Won: %d\n", CurrentProfile->EasyStats.won);
+    printf(" Easy Games Lost: %d\n\n", CurrentProfile->EasyStats.lost);
+
+    printf(" Difficult Win Rate: %.2f %%\n", difficultWinRate);
+    printf(" Difficult Games Won Average Time: %d seconds\n", difficultAverageSeconds);
+    printf(" Difficult Games Won: %d\n", CurrentProfile->DifficultStats.won);
+    printf(" Difficult Games Lost: %d\n\n\n", CurrentProfile->DifficultStats.lost);
+
+    printf(" ----------------------------------\n");
+    printf(" ----- Custom Game Statistics -----\n");
+    printf(" ----------------------------------\n\n");
+
+    printf(" Custom Win Rate: %.2f %%\n", customWinRate);
+    printf(" Custom Games Won Average Time: %d seconds\n", customAverageSeconds);
+    printf(" Custom Games Won: %d\n", CurrentProfile->CustomStats.won);
+    printf(" Custom Games Lost: %d\n\n\n", CurrentProfile->CustomStats.lost);
+
+    printf(" ------------------------\n");
+    printf(" ----- Recent Games -----\n");
+    printf(" ------------------------\n\n");
+
+    if (CurrentProfile->RecentGame1.exists) { // recent game 1
+        printf("\n ----- Recent Game 1 -----\n");
+        printf("\n Mode: %s\n", CurrentProfile->RecentGame1.mode);
+        printf("\n Outcome: %s\n", CurrentProfile->RecentGame1.outcome);
+        printBoard(&CurrentProfile->RecentGame1.Board, -1, -1, theme);
+    }
+    else {
+        printf(" %s has never played a game of Minesweeper.\n", CurrentProfile->name);
+    }
+
+    if (CurrentProfile->RecentGame2.exists) { // recent game 2
+        printf("\n\n ----- Recent Game 2 -----\n");
+        printf("\n Mode: %s\n", CurrentProfile->RecentGame2.mode);
+        printf("\n Outcome: %s\n", CurrentProfile->RecentGame2.outcome);
+        printBoard(&CurrentProfile->RecentGame2.Board, -1, -1, theme);
+    }
+
+    if (CurrentProfile->RecentGame3.exists) { // recent game 3
+        printf("\n\n ----- Recent Game 3 -----\n");
+        printf("\n Mode: %s\n", CurrentProfile->RecentGame3.mode);
+        printf("\n Outcome: %s\n", CurrentProfile->RecentGame3.outcome);
+        printBoard(&CurrentProfile->RecentGame3.Board, -1, -1, theme);
+    }
+
+    printf("\n\n");
+    printDivider();
+    printf("\n\n");
+
+    printf(" Press 'Enter' to return to the Main Menu. Press 'Delete' to reset %s's statistics.",
+        CurrentProfile->name);
+
+    if (readKey() == ARROW_VALUE && readKey() == DELETE_VALUE) { // the user confirms resetting their statistics
+        printf("\n\n Are you sure you want to reset %s's statistics?\n", CurrentProfile->name);
+        
+        if (confirmAction()) {
+            initializeProfile(CurrentProfile, CurrentProfile->name);
 
-        printf(" Please input the letter corresponding to your choice (a/b): ");
+            pace(SHORT_SLEEP);
+            printf("\n Successful.");
+            pace(SHORT_SLEEP);
 
-        scanf("%c", &userResponse);
-        clearInputBuffer();
-    } while (!(userResponse == 'a' || userResponse == 'b'));
+            printf(" %s's statistics has been reset.", CurrentProfile->name);
+            pace(LONG_SLEEP);
+            
+            printf("\n\n");
+            pressEnter();
+        }
+        else {
+            statisticsScreen(CurrentProfile, theme);
+        }
+    }
+}
 
-    if (userResponse == 'a') { // Classic Game
-        do {
-            Sleep(SHORT_SLEEP);
-            system("cls");
 
-            printf("\n");
-            printDivider();
-            printf("\n");
-            
-            printEvade(theme);
-            printf("\n");
-            
-            printf(" There are two difficulties:\n\n");
-            printf(" [a] Easy\n [b] Difficult\n\n");
+/*
+    @brief: Prints the all-time-leaderboard
+	
+	@param: CurrentLeaderboard - leaderboard structure containing necessary information to reflect
+        the all-time leaderboard
+	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void leaderboardScreen(struct Leaderboard *CurrentLeaderboard, int theme) {
+    int i;
+    struct Records *EasyRecords = &CurrentLeaderboard->EasyRecords;
+    struct Records *DifficultRecords = &CurrentLeaderboard->DifficultRecords;
+    struct Records *CustomRecords = &CurrentLeaderboard->CustomRecords;
+    
+    pace(SHORT_SLEEP);
+    clearScreen();
 
-            printDivider();
-            printf("\n\n");
+    printf("\n");
+    printDivider();
+    printf("\n\n\n");
+	
+	printLeaderboard(theme);
+    printf("\n\n");
 
-            printf(" Please input the letter corresponding to your choice (a/b): ");
+    printDivider();
+    printf("\n\n\n");
 
-            scanf("%c", &userResponse);
-            clearInputBuffer();
-        } while (!(userResponse == 'a' || userResponse == 'b'));
+    printf(" -------------------------\n");
+    printf(" ----- %s -----\n", EASY_MODE);
+    printf(" -------------------------\n\n");
 
-        if (userResponse == 'a') { // easy board
-            strcpy(CurrentGame->mode, EASY_MODE);
-            CurrentGame->rows = 8;
-            CurrentGame->columns = 8;
-            mines = 10;
-        }
-        else if (userResponse == 'b') { // difficult board
-            strcpy(CurrentGame->mode, DIFFICULT_MODE);
-            CurrentGame->rows = 10;
-            CurrentGame->columns = 15;
-            mines = 35;
+    if (EasyRecords->numRecords == 0) {
+        printf(" No easy game has been won to date.\n");
+    }
+    else {
+        for (i = 0; i < EasyRecords->numRecords; i++) {
+            printf(" %d.) %s | %d seconds\n", i + 1, EasyRecords->names[i], EasyRecords->times[i]);
         }
+    }
+
+    printf("\n\n ------------------------------\n");
+    printf(" ----- %s -----\n", DIFFICULT_MODE);
+    printf(" ------------------------------\n\n");
 
-        generateClassicGame(CurrentGame->Board, mineLocations, CurrentGame->rows, CurrentGame->columns, mines);
+    if (DifficultRecords->numRecords == 0) {
+        printf(" No difficult game has been won to date.\n");
     }
-    else if (userResponse == 'b') { // Custom Game
-        if (generateCustomGame(CurrentGame->Board, &CurrentGame->rows, &CurrentGame->columns, mineLocations, &mines, theme)) {
-            strcpy(CurrentGame->mode, CUSTOM_MODE);
+    else {
+        for (i = 0; i < DifficultRecords->numRecords; i++) {
+            printf(" %d.) %s | %d seconds\n", i + 1, DifficultRecords->names[i], DifficultRecords->times[i]);
         }
-        else return;
     }
-    
-    initializeTileStates(CurrentGame->Board, mineLocations, CurrentGame->rows, CurrentGame->columns, mines);
 
-    Sleep(SHORT_SLEEP);
-    time(&startTime); // start tracking the time
+    printf("\n\n ------------------\n");
+    printf(" ----- %s -----\n", CUSTOM_MODE);
+    printf(" ------------------\n\n");
 
-    while (gameState == 0) { // run the game while the user has not yet won/lost/quit
-        do {
-            system("cls");
+    if (CustomRecords->numRecords == 0) {
+        printf(" No custom game has been won to date.\n");
+    }
+    else {
+        for (i = 0; i < CustomRecords->numRecords; i++) {
+            printf(" %d.) %s | %d seconds\n", i + 1, CustomRecords->names[i], CustomRecords->times[i]);
+        }
+    }
 
-            printEvade(theme);
-            printBoard(CurrentGame->Board, CurrentGame->rows, CurrentGame->columns, currRow, currColumn, theme);
-            printf("\n Navigate the game board with your arrow keys.\n\n");
-            printf(" Press 'Enter' to select your action. Press 'Esc' to quit the game.");
+    printf("\n\n");
+    printDivider();
+    printf("\n\n");
 
-            keyValue = detectKeyPress(&currRow, &currColumn, CurrentGame->rows, CurrentGame->columns);
-            Sleep(BOARD_REFRESH);
+    printf(" Press 'Enter' to return to the Main Menu. Press 'Delete' to reset the all-time leaderboard.");
 
-            if (keyValue == ESCAPE_VALUE) { // user wants to quit
-                printf("\n\n Are you sure you want to quit?\n");
-                
-                if (confirmAction()) { // user confirms quitting
-                    gameState = 3;
-                }
-                else {
-                    keyValue = 0;
-                }
-            }
-        } while (!(keyValue == ENTER_VALUE || keyValue == ESCAPE_VALUE)); // wait for an enter key press
+    if (readKey() == ARROW_VALUE && readKey() == DELETE_VALUE) { // the user confirms resetting their statistics
+        printf("\n\n Are you sure you want to reset the all-time leaderboard?\n");
+        
+        if (confirmAction()) {
+            remove(LEADERBOARD_DIRECTORY);
+            loadLeaderboard(CurrentLeaderboard);
 
-        system("cls");
-        printEvade(theme);
-        printBoard(CurrentGame->Board, CurrentGame->rows, CurrentGame->columns, currRow, currColumn, theme);
+            pace(SHORT_SLEEP);
+            printf("\n Successful.");
+            pace(SHORT_SLEEP);
 
-        if (gameState != 3) { // user has not quit
-            do {
-                system("cls");
+            printf(" The all-time leaderboard has been reset.");
+            pace(LONG_SLEEP);
+            
+            printf("\n\n");
+            pressEnter();
+        }
+        else {
+            leaderboardScreen(CurrentLeaderboard, theme);
+        }
+    }
+}
 
-                printEvade(theme);
-                printBoard(CurrentGame->Board, CurrentGame->rows, CurrentGame->columns, currRow, currColumn, theme);
-                printf("\n Inspect [I], Flag [F], Remove Flag [R], or Unselect [U]: ");
 
-                scanf("%c", &userResponse);
-                clearInputBuffer();
-            } while (!(userResponse == 'I' || userResponse == 'F' || userResponse == 'R' || userResponse == 'U'));
+/*
+    @brief: prints the termination sequence
 
-            if (userResponse == 'I') { // user chose to inspect
-                revealTiles(CurrentGame->Board, CurrentGame->rows, CurrentGame->columns, currRow, currColumn);
-            }
-            else if (userResponse == 'F') { // user chose to flag
-                CurrentGame->Board[currRow][currColumn].isFlagged = 1;
-            }
-            else if (userResponse == 'R') { // user chose to remove a flag
-                CurrentGame->Board[currRow][currColumn].isFlagged = 0;
-            }
+    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+*/
+void terminationSequence(int theme) {
+    pace(SHORT_SLEEP);
+    clearScreen();
 
-            gameState = getGameState(CurrentGame->Board, CurrentProfile->CurrentGame.rows, CurrentProfile->CurrentGame.columns, mineLocations, mines);
-        }
-    }
+    pace(SHORT_SLEEP);
+    printEnd(theme);
+    pace(LONG_SLEEP);
+    
+    printf("\n Thank you for trying out our Minesweeper program! :D");
 
-    // post-game processing
-    system("cls");
+    pace(LONG_SLEEP);
+    printf("\n - CJ & Andre");
 
-    time(&endTime);
-    timeTaken = difftime(endTime, startTime);
+    pace(LONG_SLEEP);
+    printf("\n");
+}
 
-    CurrentGame->exists = 1;
-    CurrentProfile->lifetimeGames++;
-    setMineVisibility(1, CurrentGame->Board, mineLocations, mines);
 
-    printEvade(theme);
-    printBoard(CurrentGame->Board, CurrentGame->rows, CurrentGame->columns, -1, -1, theme);
-    printf("\n");
-    Sleep(SHORT_SLEEP);
+/*
+    @brief: times the recursive and the scanline versions of revealTiles against each other on
+        the same boards, and prints the results. Every board is opened from its first blank tile,
+        which is where the flood fill does the most work.
+*/
+void benchmarkReveal() {
+    struct Board Board;
+    int i, j, k;
+    int start;
+    int numTiles, numRevealed;
+    long long totalRevealed;
+    long long startTime, recursiveTime, scanlineTime;
+    int mismatches;
+
+    // rows, columns, mines, and boards timed for each configuration; the recursive version needs
+    // the open region to fit on the call stack, so the configurations stay moderate
+    int configurations[4][4] = {
+        {16, 30, 40, 20000},
+        {50, 50, 100, 5000},
+        {100, 100, 300, 2000},
+        {200, 200, 600, 200}
+    };
+
+    initializeBoard(&Board);
+
+    printf("\n %-10s %8s %12s %14s %14s %9s\n", "board", "boards", "tiles/board", "recursive ms",
+        "scanline ms", "speedup");
+
+    for (i = 0; i < 4; i++) {
+        recursiveTime = 0;
+        scanlineTime = 0;
+        totalRevealed = 0;
+        mismatches = 0;
+
+        for (j = 0; j < configurations[i][3]; j++) {
+            if (!clearBoard(&Board, configurations[i][0], configurations[i][1])) return;
+            generateClassicGame(&Board, configurations[i][2], j);
+            initializeTileStates(&Board);
+
+            numTiles = Board.rows * Board.columns;
+            for (start = 0; start < numTiles - 1 && Board.states[start] != 0; start++);
+
+            startTime = getMicroseconds();
+            revealTilesRecursive(&Board, start / Board.columns, start % Board.columns);
+            recursiveTime += getMicroseconds() - startTime;
+
+            numRevealed = 0;
+            for (k = 0; k < getNumWords(&Board); k++) {
+                numRevealed += __builtin_popcountll(Board.revealedPlane[k]);
+            }
 
-    if (gameState == 1) { // user won
-        strcpy(CurrentGame->outcome, WON_OUTCOME);
+            resetBoardProgress(&Board);
 
-        printf ("\x1b[1m\x1b[37m %c %c %c%c%c %c %c  %c   %c %c%c%c %c%c%c\x1b[0m\n", 219, 219, 219, 223, 219, 219, 219, 219, 219, 219, 223, 219, 219, 223, 219);
-	  	printf ("\x1b[1m\x1b[32m %c%c%c %c %c %c %c  %c %c %c %c %c %c %c\x1b[0m\n", 223, 219, 223, 219, 219, 219, 219, 219, 220, 219, 219, 219, 219, 219);
-	  	printf ("\x1b[1m\x1b[37m  %c  %c%c%c %c%c%c  %c%c%c%c%c %c%c%c %c %c\x1b[0m\n\n", 219, 219, 220, 219, 219, 220, 219, 219, 220, 223, 220, 219, 219, 220, 219, 219, 219);
+            startTime = getMicroseconds();
+            totalRevealed += revealTiles(&Board, start / Board.columns, start % Board.columns);
+            scanlineTime += getMicroseconds() - startTime;
 
-        Sleep(SHORT_SLEEP);
-        printf(" You won!");
-    }
-    else if (gameState == 2) { // user lost
-        strcpy(CurrentGame->outcome, LOST_OUTCOME);
-        
-		printf ("\x1b[1m\x1b[37m %c %c %c%c%c %c %c  %c   %c%c%c %c%c%c %c%c%c\x1b[0m\n", 219, 219, 219, 223, 219, 219, 219, 219, 219, 223, 219, 219, 223, 223, 223, 219, 223);
-	  	printf ("\x1b[1m\x1b[31m %c%c%c %c %c %c %c  %c   %c %c %c%c%c  %c\x1b[0m\n", 223, 219, 223, 219, 219, 219, 219, 219, 219, 219, 223, 223, 219, 219);
-	  	printf ("\x1b[1m\x1b[37m  %c  %c%c%c %c%c%c  %c%c%c %c%c%c %c%c%c  %c\x1b[0m\n\n", 219, 219, 220, 219, 219, 220, 219, 219, 220, 220, 219, 220, 219, 220, 220, 219, 219);
-	
-        Sleep(SHORT_SLEEP);
-        printf(" You inspected a mine!");
-    }
-    else if (gameState == 3) { // user quit
-        strcpy(CurrentGame->outcome, QUIT_OUTCOME);
+            for (k = 0; k < getNumWords(&Board); k++) {
+                numRevealed -= __builtin_popcountll(Board.revealedPlane[k]);
+            }
 
-        setMineVisibility(0, CurrentGame->Board, mineLocations, mines);
-        Sleep(SHORT_SLEEP);
-        printf(" Game quitted successfully.");
-    }
+            if (numRevealed != 0) mismatches++;
+        }
 
-    Sleep(LONG_SLEEP);
-    printf("\n\n Time: %d seconds", timeTaken);
-    CurrentGame->seconds = timeTaken; // update game time
+        printf(" %4dx%-5d %8d %12lld %14.3f %14.3f %8.2fx", configurations[i][0], configurations[i][1],
+            configurations[i][3], totalRevealed / configurations[i][3], recursiveTime / 1000.0,
+            scanlineTime / 1000.0, scanlineTime > 0 ? (double) recursiveTime / scanlineTime : 0);
 
-    // update profile and leaderboard information
-    rank = updateLeaderboard(CurrentGame->mode, CurrentGame->outcome, CurrentProfile->name, CurrentGame->seconds, CurrentLeaderboard);
+        if (mismatches > 0) {
+            printf("  (%d boards revealed differently!)", mismatches);
+        }
 
-    if (rank != 0) { // user set a new record
-        Sleep(LONG_SLEEP);
-        printf("\n\n Congratulations! You set a new #%d record for %s in the all-time leaderboard!", rank, CurrentGame->mode);
+        printf("\n");
     }
 
-    updateProfile(CurrentProfile);
-
-    Sleep(LONG_SLEEP);
-    printf("\n\n");
-    pressEnter();
+    freeBoard(&Board);
 }
 
 
 /*
-    @brief: checks if a level created is valid or not
-	
-	@param: Board - a 2-dimensional array of tiles representing the current game board
-	@param: rows - indicates the number of rows
-	@param: columns - indicates the number of columns
-	
-	@return: 0 - level is not valid
-			 1 - level is valid (there is at least 1 mine and 1 non-mine tile)
+    @brief: times generateClassicGame on boards of increasing size and mine density, and prints how
+        many boards and mines it generates per second
 */
-int isValidLevel(struct Tile Board[][15], int rows, int columns) {
-    int mineCount = 0;
+void benchmarkGenerate() {
+    struct Board Board;
     int i, j;
+    long long startTime, totalTime;
+    double seconds;
 
-    for (i = 0; i < rows; i++) {
-        for (j = 0; j < columns; j++) {
-            if (Board[i][j].state == 9) {
-                mineCount++;
-            }
+    // rows, columns, mines, and boards generated for each configuration
+    int configurations[5][4] = {
+        {16, 30, 99, 200000},
+        {100, 100, 2000, 20000},
+        {1000, 1000, 200000, 50},
+        {1000, 1000, 500000, 50},
+        {1000, 1000, 900000, 50}
+    };
+
+    initializeBoard(&Board);
+
+    printf("\n %-10s %8s %8s %12s %14s %14s\n", "board", "mines", "boards", "total ms", "boards/s",
+        "mines/s");
+
+    for (i = 0; i < 5; i++) {
+        totalTime = 0;
+
+        for (j = 0; j < configurations[i][3]; j++) {
+            if (!clearBoard(&Board, configurations[i][0], configurations[i][1])) return;
+
+            startTime = getMicroseconds();
+            if (!generateClassicGame(&Board, configurations[i][2], j)) return;
+            totalTime += getMicroseconds() - startTime;
         }
+
+        seconds = totalTime > 0 ? totalTime / 1000000.0 : 1e-6;
+        printf(" %4dx%-5d %8d %8d %12.3f %14.0f %14.0f\n", configurations[i][0], configurations[i][1],
+            configurations[i][2], configurations[i][3], totalTime / 1000.0, configurations[i][3] / seconds,
+            (double) configurations[i][2] * configurations[i][3] / seconds);
     }
 
-    return mineCount > 0 && mineCount < rows * columns;
+    freeBoard(&Board);
 }
 
 
 /*
-    @brief: guides the user in creating a level; handles the underlying logic and file creation;
-        updates the list of levels
-	
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-	
-	Precondition: LEVELS_DIRECTORY is accurate.
+    @brief: times initializeTileStates against the mine-by-mine version on the same boards, checks
+        that both give the same states, and prints the results
 */
-void createLevel(int theme) {
-    FILE *fp;
-    FILE *fp2;
+void benchmarkInitialize() {
+    struct Board Board;
     int i, j;
-    struct Tile Board[10][15];
-
-    string100 directory;
-    string100 name;
-    char userResponse;
-
-    int numRows, numColumns;
-    int row, column;
-    int isConfirmed;
-    int isValid;
-
-    string100 levels[MAX_LEVELS];
-    int numLevels;
+    int numTiles;
+    long long startTime, byMineTime, boxSumTime;
+    int mismatches;
+    unsigned char *expected = NULL;
+    unsigned char *newExpected;
+
+    // rows, columns, mines, and boards timed for each configuration
+    int configurations[5][4] = {
+        {16, 30, 99, 50000},
+        {100, 100, 2000, 2000},
+        {1000, 1000, 10000, 50},
+        {1000, 1000, 200000, 50},
+        {2000, 2000, 2000000, 10}
+    };
+
+    initializeBoard(&Board);
+
+#if defined(__AVX2__)
+    printf("\n kernel: AVX2\n");
+#elif defined(__SSE2__)
+    printf("\n kernel: SSE2\n");
+#else
+    printf("\n kernel: scalar\n");
+#endif
+
+    printf("\n %-10s %8s %8s %12s %12s %9s\n", "board", "mines", "boards", "by mine ms", "box sum ms",
+        "speedup");
+
+    for (i = 0; i < 5; i++) {
+        byMineTime = 0;
+        boxSumTime = 0;
+        mismatches = 0;
+        numTiles = configurations[i][0] * configurations[i][1];
+
+        newExpected = realloc(expected, numTiles);
+        if (newExpected == NULL) break;
+        expected = newExpected;
+
+        for (j = 0; j < configurations[i][3]; j++) {
+            if (!clearBoard(&Board, configurations[i][0], configurations[i][1])) break;
+            generateClassicGame(&Board, configurations[i][2], j);
+
+            startTime = getMicroseconds();
+            initializeTileStatesByMine(&Board);
+            byMineTime += getMicroseconds() - startTime;
+
+            memcpy(expected, Board.states, numTiles);
+            clearBoard(&Board, configurations[i][0], configurations[i][1]);
+            generateClassicGame(&Board, configurations[i][2], j);
+
+            startTime = getMicroseconds();
+            initializeTileStates(&Board);
+            boxSumTime += getMicroseconds() - startTime;
+
+            if (memcmp(expected, Board.states, numTiles) != 0) mismatches++;
+        }
 
-    fp = fopen(LEVELS_DIRECTORY, "r");
+        printf(" %4dx%-5d %8d %8d %12.3f %12.3f %8.2fx", configurations[i][0], configurations[i][1],
+            configurations[i][2], configurations[i][3], byMineTime / 1000.0, boxSumTime / 1000.0,
+            boxSumTime > 0 ? (double) byMineTime / boxSumTime : 0);
 
-    if (fp == NULL) {
-        fp = fopen(LEVELS_DIRECTORY, "w");
-        fprintf(fp, "0\n");
-        fclose(fp);
+        if (mismatches > 0) {
+            printf("  (%d boards initialized differently!)", mismatches);
+        }
 
-        createLevel(theme);
-        return;
+        printf("\n");
     }
 
-    fscanf(fp, "%d", &numLevels);
+    free(expected);
+    freeBoard(&Board);
+}
 
-    if (numLevels >= MAX_LEVELS) {
-        Sleep(SHORT_SLEEP);
 
-        printf("\nSorry, you cannot create a new level as there can only be a maximum of %d levels.", MAX_LEVELS);
-        Sleep(LONG_SLEEP);
+/*
+    @brief: picks a random hidden tile, leaving out the ones the player knows are mines
 
-        printf("\n\n");
-        pressEnter();
-        return;
-    }
+    @param: Player - pointer to the player
+    @param: isUsingSolver - 1 if the tiles the solver last deduced to be mines are left out
 
-    // initialize the board, i.e., the 2D array of tiles
-    for (i = 0; i < MAX_ROWS; i++) {
-        for (j = 0; j < MAX_COLUMNS; j++) {
-            Board[i][j].state = 0;
-            Board[i][j].isFlagged = 0;
-            Board[i][j].isRevealed = 0;
-        }
-    }
+    @return: flat index of the tile
 
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
+    Precondition: the game is ongoing, so some hidden tile is safe.
+*/
+int pickRandomTile(struct BotPlayer *Player, int isUsingSolver) {
+    struct Board *Board = &Player->Board;
+    int numTiles = Board->rows * Board->columns;
+    int tile;
 
-        printf("\n");
-        printDivider();
+    do {
+        tile = getRandomBelow(&Player->Random, numTiles);
+    } while (getBit(Board->revealedPlane, tile) ||
+        (isUsingSolver && Player->Solver.capacity > 0 && getBit(Player->Solver.minePlane, tile)));
 
-        printLevels(theme);
+    return tile;
+}
 
-        printf("\n");
-        printDivider();
-        printf("\n\n");
 
-        printf(" Enter a valid name for the level (or '0' to return to the main menu): ");
-        scanf("%s", name);
-        clearInputBuffer();
+/*
+    @brief: takes the next tile the solver deduced to be safe that is still hidden; solves the
+        position again once none is left
 
-        if (strcmp(name, "0") == 0) return;
+    @param: Player - pointer to the player
 
-        strcpy(directory, "levels\\");
-        strcat(directory, name);
-        strcat(directory, ".txt");
-        fp2 = fopen(directory, "r");
+    @return: flat index of a safe tile; -1 if nothing is certainly safe
+*/
+int takeSafeTile(struct BotPlayer *Player) {
+    struct Board *Board = &Player->Board;
+    struct Solver *Solver = &Player->Solver;
 
-        if (fp2 != NULL) { // user provided a name that already exists
-            printf("\n The name '%s' has already been taken!", name);
-            fclose(fp2);
-        }
-    } while (fp2 != NULL);
+    while (Player->nextSafe < Solver->numSafe && getBit(Board->revealedPlane, Solver->safeCells[Player->nextSafe])) {
+        Player->nextSafe++;
+    }
 
-    fp2 = fopen(directory, "w"); // create the text file
+    if (Player->nextSafe == Solver->numSafe) {
+        Player->nextSafe = 0;
+        if (solvePosition(Board, Solver, 0) < 0) Solver->numSafe = 0;
+    }
 
-    do {
-        printf("\n Enter the number of rows [5-10]: ");
-        scanf("%d", &numRows);
-        clearInputBuffer();
-    } while (!(numRows >= 5 && numRows <= 10));
+    return Player->nextSafe < Solver->numSafe ? Solver->safeCells[Player->nextSafe++] : -1;
+}
 
-    do {
-        printf("\n Enter the number of columns [5-15]: ");
-        scanf("%d", &numColumns);
-        clearInputBuffer();
-    } while (!(numColumns >= 5 && numColumns <= 15));
 
-    fprintf(fp2, "%d %d\n", numRows, numColumns);
+/*
+    @brief: a bot that inspects random hidden tiles
 
-    do {
-        do {
-            Sleep(SHORT_SLEEP);
-            system("cls");
+    @param: Player - pointer to the player
 
-            printEvade(theme);
-            printBoard(Board, numRows, numColumns, -1, -1, theme);
-            printf("\n Place Mine [P], Delete Mine [D], or Finish Editing [F]: ");
-            scanf("%c", &userResponse);
-            clearInputBuffer();
-        } while (!(userResponse == 'P' || userResponse == 'D' || userResponse == 'F'));
+    @return: flat index of the tile to inspect
+*/
+int chooseRandomTile(struct BotPlayer *Player) {
+    return pickRandomTile(Player, 0);
+}
 
-        if (userResponse == 'F') { // user is finished editing
-            printf("\n Are you sure you are finished editing?\n");
-            
-            isConfirmed = confirmAction();
 
-            if (isConfirmed) {
-                isValid = isValidLevel(Board, numRows, numColumns);
+/*
+    @brief: a bot that inspects the tiles the solver deduces to be safe and guesses a random tile
+        that is not a known mine when stuck
 
-                if (isValid) { // valid level
-                    Sleep(SHORT_SLEEP);
+    @param: Player - pointer to the player
 
-                    for (i = 0; i < numLevels; i++) {
-                        fscanf(fp, "%s", levels[i]);
-                    }
-                    fclose(fp);
+    @return: flat index of the tile to inspect
+*/
+int chooseLogicTile(struct BotPlayer *Player) {
+    int tile = takeSafeTile(Player);
 
-                    fp = fopen(LEVELS_DIRECTORY, "w");
-                    fprintf(fp, "%d\n", numLevels + 1);
-                    for (i = 0; i < numLevels; i++) {
-                        fprintf(fp, "%s\n", levels[i]);
-                    }
-                    fprintf(fp, "%s\n", name);
-                    fclose(fp);
-                }
-                else { // invalid level
-                    printf("\n Error. Please continue editing, as a level should have at least one mine and at least one plain tile.");
-                    Sleep(LONG_SLEEP);
-                }
-            }
-        }
-        else { // user wants to place or delete a mine
-            do {
-                printf("\n Enter row: ");
-                scanf("%d", &row);
-                clearInputBuffer();
-            } while (!(row >= 1 && row <= numRows));
+    return tile >= 0 ? tile : pickRandomTile(Player, 1);
+}
 
-            do {
-                printf("\n Enter column: ");
-                scanf("%d", &column);
-                clearInputBuffer();
-            } while (!(column >= 1 && column <= numColumns));
 
-            if (userResponse == 'P') {
-                Board[row - 1][column - 1].state = 9;
-                Board[row - 1][column - 1].isRevealed = 1;
-            }
-            else if (userResponse == 'D') {
-                Board[row - 1][column - 1].state = 0;
-                Board[row - 1][column - 1].isRevealed = 0;
-            }
-        }
-    } while (!isConfirmed || !isValid);
+/*
+    @brief: a bot that inspects the tiles the solver deduces to be safe and, when stuck, guesses the
+        tile least likely to be a mine, choosing at random among equally likely tiles
 
-    // post-edit processing
-    for (i = 0; i < numRows; i++) {
-        for (j = 0; j < numColumns; j++) {
-            if (Board[i][j].state == 0) {
-                fprintf(fp2, "%c", '.');
-            }
-            else if (Board[i][j].state == 9) {
-                fprintf(fp2, "%c", 'X');
-            }
+    @param: Player - pointer to the player
+
+    @return: flat index of the tile to inspect
+*/
+int chooseProbabilityTile(struct BotPlayer *Player) {
+    struct Board *Board = &Player->Board;
+    int numTiles = Board->rows * Board->columns;
+    int tile = takeSafeTile(Player);
+    int best = -1;
+    int numTied = 0;
+
+    if (tile >= 0) return tile;
+    if (!computeProbabilities(Board, &Player->Solver, &Player->Map, NULL)) return pickRandomTile(Player, 1);
+
+    for (tile = 0; tile < numTiles; tile++) {
+        if (getBit(Board->revealedPlane, tile)) continue;
+
+        if (best < 0 || Player->Map.mineChance[tile] < Player->Map.mineChance[best]) {
+            best = tile;
+            numTied = 1;
+        }
+        else if (Player->Map.mineChance[tile] == Player->Map.mineChance[best] &&
+            getRandomBelow(&Player->Random, ++numTied) == 0) { // each tied tile is kept with equal chance
+            best = tile;
         }
-        fprintf(fp2, "\n");
     }
-    fclose(fp2);
-
-    Sleep(SHORT_SLEEP);
-    printf("\n Successful.");
-    Sleep(SHORT_SLEEP);
 
-    printf(" The custom level '%s' has been saved.", name);
-    Sleep(LONG_SLEEP);
-    
-    printf("\n\n");
-    pressEnter();
+    return best;
 }
 
 
 /*
-    @param: guides the user in deleting a level; ensures that the user deletes an actual level;
-	
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @brief: finds a bot by its name
+
+    @param: name - name of the bot; NULL for the default bot
+
+    @return: pointer to the bot; NULL if there is no bot with that name
 */
-void deleteLevel(int theme) {
-    FILE *fp;
-    FILE *fp2;
+struct Bot *findBot(char name[]) {
+    static struct Bot Bots[] = {
+        {"probability", "solver, then the tile least likely to be a mine", chooseProbabilityTile},
+        {"logic", "solver, then a random tile", chooseLogicTile},
+        {"random", "random tiles", chooseRandomTile}
+    };
     int i;
 
-    string100 directory;
-    string100 name;
+    for (i = 0; i < (int) (sizeof(Bots) / sizeof(Bots[0])); i++) {
+        if (name == NULL || strcmp(name, Bots[i].name) == 0) return &Bots[i];
+    }
 
-    string100 levels[MAX_LEVELS];
-    string100 level;
-    int numLevels;
+    return NULL;
+}
 
-    fp = fopen(LEVELS_DIRECTORY, "r");
 
-    if (fp == NULL) {
-        fp = fopen(LEVELS_DIRECTORY, "w");
-        fprintf(fp, "0\n");
-        fclose(fp);
+/*
+    @brief: prepares a bot player with no games played; it holds no buffers until it is given a board
 
-        deleteLevel(theme);
-        return;
-    }
+    @param: Player - pointer to the player being initialized
+    @param: seed - seed of the player's random stream
+*/
+void initializeBotPlayer(struct BotPlayer *Player, unsigned long long seed) {
+    initializeBoard(&Player->Board);
+    initializeSolver(&Player->Solver);
+    initializeProbabilityMap(&Player->Map);
+    seedRandom(&Player->Random, seed);
+
+    Player->nextSafe = 0;
+    Player->numGames = 0;
+    Player->numWon = 0;
+    Player->numMoves = 0;
+    memset(Player->phaseNanoseconds, 0, sizeof(Player->phaseNanoseconds));
+}
 
-    fscanf(fp, "%d", &numLevels);
 
-    do {
-        Sleep(SHORT_SLEEP);
-        system("cls");
-        
-        printf("\n");
-        printDivider();
+/*
+    @brief: releases the buffers of a bot player
 
-        printLevels(theme);
+    @param: Player - pointer to the player being freed
+*/
+void freeBotPlayer(struct BotPlayer *Player) {
+    freeBoard(&Player->Board);
+    freeSolver(&Player->Solver);
+    freeProbabilityMap(&Player->Map);
+}
 
-        printf("\n");
-        printDivider();
-        printf("\n\n");
 
-        printf(" Enter an existing level to delete (or '0' to return to the main menu): ");
-        scanf("%s", name);
-        clearInputBuffer();
+/*
+    @brief: plays one game on the player's board from the start with a bot, the way gameHandler
+        runs a game but with no input, output, or waiting: a classic board is generated around the
+        first inspection, and every move is an inspect action followed by a check of the game's
+        state. The result, the number of moves, and the time spent in each phase are added to the
+        player's totals.
+
+    @param: Player - pointer to the player; its board holds the game, with the dimensions of the
+        game and, for a custom level, its mines
+    @param: Bot - pointer to the bot choosing the moves
+    @param: numMines - number of mines of a classic game; 0 for a custom level, whose board is kept
+*/
+void playBotGame(struct BotPlayer *Player, struct Bot *Bot, int numMines) {
+    struct Board *Board = &Player->Board;
+    struct Action Action;
+    int isGenerated = numMines == 0;
+    int gameState;
+    int numAttempts;
+    long long startTime, endTime;
+
+    if (isGenerated) {
+        resetBoardProgress(Board);
+    }
+    else {
+        clearBoard(Board, Board->rows, Board->columns); // same size, so no allocation
+    }
 
-        if (strcmp(name, "0") == 0) return;
+    Player->nextSafe = 0;
+    Player->Solver.numSafe = 0;
+    Action.type = 'I';
+    Action.milliseconds = 0;
+
+    startTime = getNanoseconds();
+    gameState = getGameState(Board);
+    endTime = getNanoseconds();
+    Player->phaseNanoseconds[PHASE_CHECK] += endTime - startTime;
+
+    while (gameState == 0) {
+        startTime = endTime;
+        Action.tile = Bot->chooseTile(Player);
+        endTime = getNanoseconds();
+        Player->phaseNanoseconds[PHASE_CHOOSE] += endTime - startTime;
+
+        if (!isGenerated) { // the board is built around the first inspection
+            startTime = endTime;
+            generateNoGuessGame(Board, &Player->Solver, numMines, Action.tile / Board->columns,
+                Action.tile % Board->columns, getRandom(&Player->Random), &numAttempts);
+            Player->Solver.numSafe = 0; // its deductions were about the boards tried
+            isGenerated = 1;
+            endTime = getNanoseconds();
+            Player->phaseNanoseconds[PHASE_GENERATE] += endTime - startTime;
+        }
 
-        strcpy(directory, "levels\\");
-        strcat(directory, name);
-        strcat(directory, ".txt");
+        startTime = endTime;
+        applyAction(Board, NULL, &Action);
+        endTime = getNanoseconds();
+        Player->phaseNanoseconds[PHASE_REVEAL] += endTime - startTime;
 
-        fp2 = fopen(directory, "r");
-        if (fp2 == NULL) {
-            printf("\n The level '%s' does not exist!", name);
-        }
-    } while (fp2 == NULL);
-    
-    fclose(fp2);
-    printf("\n Are you sure you want to delete the level '%s'?\n", name);
+        startTime = endTime;
+        gameState = getGameState(Board);
+        endTime = getNanoseconds();
+        Player->phaseNanoseconds[PHASE_CHECK] += endTime - startTime;
 
-    if (confirmAction()) {
-        for (i = 0; i < numLevels; i++) {
-            fscanf(fp, "%s", level);
-            strcpy(levels[i], level);
-        }
+        Player->numMoves++;
+    }
 
-        fclose(fp);
-        fp = fopen(LEVELS_DIRECTORY, "w");
-        fprintf(fp, "%d\n", numLevels - 1);
+    Player->numGames++;
+    Player->numWon += gameState == 1;
+}
 
-        for (i = 0; i < numLevels; i++) {
-            if (!(strcmp(levels[i], "") == 0 || strcmp(levels[i], name) == 0)) {
-                fprintf(fp, "%s\n", levels[i]);
+
+/*
+    @brief: times generateNoGuessGame on the classic difficulties, each game opened from a random
+        tile, and prints how many boards per second it produces, how many boards it generates for
+        each one it keeps, and how many games had to settle for a board that needs a guess
+*/
+void benchmarkNoGuess() {
+    struct Board Board;
+    struct Solver Solver;
+    struct Random Random;
+    int i, j;
+    int numAttempts;
+    long long totalAttempts;
+    int numFailed;
+    long long startTime, totalTime;
+    double seconds;
+
+    // rows, columns, mines, and games generated for each configuration
+    int configurations[3][4] = {
+        {8, 8, 10, 20000},
+        {10, 15, 35, 1000},
+        {16, 30, 99, 200}
+    };
+
+    initializeBoard(&Board);
+    initializeSolver(&Solver);
+    seedRandom(&Random, 1);
+
+    printf("\n %-10s %8s %8s %12s %12s %14s %8s\n", "board", "mines", "games", "total ms", "games/s",
+        "boards/game", "guess");
+
+    for (i = 0; i < 3; i++) {
+        totalTime = 0;
+        totalAttempts = 0;
+        numFailed = 0;
+
+        for (j = 0; j < configurations[i][3]; j++) {
+            if (!clearBoard(&Board, configurations[i][0], configurations[i][1])) return;
+
+            startTime = getMicroseconds();
+            if (!generateNoGuessGame(&Board, &Solver, configurations[i][2],
+                getRandomBelow(&Random, configurations[i][0]), getRandomBelow(&Random, configurations[i][1]),
+                j, &numAttempts)) {
+                numFailed++;
             }
+            totalTime += getMicroseconds() - startTime;
+            totalAttempts += numAttempts;
         }
 
-        remove(directory);
-    } else {
-        deleteLevel(theme);
+        seconds = totalTime > 0 ? totalTime / 1000000.0 : 1e-6;
+        printf(" %4dx%-5d %8d %8d %12.3f %12.0f %14.2f %8d\n", configurations[i][0], configurations[i][1],
+            configurations[i][2], configurations[i][3], totalTime / 1000.0, configurations[i][3] / seconds,
+            (double) totalAttempts / configurations[i][3], numFailed);
     }
 
-    Sleep(SHORT_SLEEP);
-    printf("\n Successful.");
-    Sleep(SHORT_SLEEP);
-
-    printf(" The custom level '%s' has been deleted from the levels folder.", name);
-    Sleep(LONG_SLEEP);
-    
-    printf("\n\n");
-    pressEnter();
-    fclose(fp);
+    freeSolver(&Solver);
+    freeBoard(&Board);
 }
 
 
 /*
-    @brief: computes the winrate given the number of games won and lost in a particular mode
-	
-	@param: wins - indicates the total games won in a specific mode
-	@param: losses - indicates the total games lost in a specific mode
-	
-	@return: 0 if no game has been played
-             otherwise, the winrate in float percentage
-
-    Precondition: Assumes wins and losses are from the same game mode.
+    @brief: times solvePosition on the positions of expert games played by the solver from a random
+        opening; whenever the solver is stuck, a random safe tile is inspected for it. Prints the
+        average and slowest solve, how many solves took over a millisecond, and how many tiles each
+        solve deduced on average. The slowest solve is also given in processor time, since a solve
+        that waited for a processor looks slow on the clock without having done more work.
 */
-float getWinRate(int wins, int losses) {
-    if (wins + losses == 0) return 0;
-    return (float) wins / (wins + losses) * 100;
+void benchmarkSolve() {
+    struct Board Board;
+    struct Solver Solver;
+    struct Random Random;
+    int i, j;
+    int tile;
+    int numGames = 200;
+    int numSolves = 0;
+    int numSlow = 0;
+    long long numDeduced = 0;
+    long long startTime, elapsed, totalTime = 0, slowestTime = 0;
+    long long startProcessorTime, processorTime, slowestProcessorTime = 0;
+
+    initializeBoard(&Board);
+    initializeSolver(&Solver);
+    seedRandom(&Random, 1);
+
+    for (i = 0; i < numGames; i++) {
+        if (!clearBoard(&Board, 16, 30) || !placeMines(&Board, 99, &Random, 8, 15)) return;
+        initializeTileStates(&Board);
+        revealTiles(&Board, 8, 15);
+
+        while (Board.numHiddenSafe > 0) {
+            startProcessorTime = getThreadMicroseconds();
+            startTime = getMicroseconds();
+            solvePosition(&Board, &Solver, 0);
+            elapsed = getMicroseconds() - startTime;
+            processorTime = getThreadMicroseconds() - startProcessorTime;
+
+            totalTime += elapsed;
+            if (elapsed > slowestTime) slowestTime = elapsed;
+            if (processorTime > slowestProcessorTime) slowestProcessorTime = processorTime;
+            if (elapsed > 1000) numSlow++;
+            numSolves++;
+            numDeduced += Solver.numSafe + Solver.numMines;
+
+            for (j = 0; j < Solver.numSafe; j++) {
+                revealTiles(&Board, Solver.safeCells[j] / 30, Solver.safeCells[j] % 30);
+            }
+
+            if (Solver.numSafe == 0) { // stuck; guess right
+                do {
+                    tile = getRandomBelow(&Random, 16 * 30);
+                } while (hasMine(&Board, tile) || getBit(Board.revealedPlane, tile));
+
+                revealTiles(&Board, tile / 30, tile % 30);
+            }
+        }
+    }
+
+    printf("\n %-10s %8s %8s %12s %12s %10s %14s %14s\n", "board", "games", "solves", "average us", "slowest us",
+        "over 1 ms", "slowest cpu us", "tiles/solve");
+    printf(" %4dx%-5d %8d %8d %12.2f %12lld %10d %14lld %14.2f\n", 16, 30, numGames, numSolves,
+        (double) totalTime / numSolves, slowestTime, numSlow, slowestProcessorTime, (double) numDeduced / numSolves);
+
+    freeSolver(&Solver);
+    freeBoard(&Board);
 }
 
 
 /*
-    @brief: computes the average time in seconds to win in a particular mode
-	
-	@param: totalSeconds - indicates the total time it took to win across all games in a specific mode
-	@param: gamesWon - indicates the total number of games won the profile has in a specific mode
-	
-	@return: average seconds of the profile in a specific game mode won as int
-
-    Precondition: Assumes totalSeconds and gamesWon are from the same game mode.
+    @brief: times computeProbabilities on the positions of classic games played by the solver from
+        a random opening, with the components weighed on a pool with a thread per processor.
+        Whenever the solver is stuck, the safest tile is inspected, or a random safe tile if the
+        safest one is a mine. Prints the average and slowest computation and the share of
+        positions whose chances were exact.
 */
-int getAverageSeconds(int totalSeconds, int gamesWon) {
-    if (gamesWon == 0) return 0;
-    return totalSeconds / gamesWon;
+void benchmarkProbabilities() {
+    struct Board Board;
+    struct Solver Solver;
+    struct ProbabilityMap Map;
+    struct ThreadPool Pool;
+    struct Random Random;
+    int i, j, k;
+    int tile, safest;
+    int numTiles;
+    int numPositions, numExact;
+    long long startTime, elapsed, totalTime, slowestTime;
+
+    // rows, columns, mines, and games played for each configuration
+    int configurations[2][4] = {
+        {10, 15, 35, 200},
+        {16, 30, 99, 100}
+    };
+
+    initializeBoard(&Board);
+    initializeSolver(&Solver);
+    initializeProbabilityMap(&Map);
+    initializeThreadPool(&Pool, getNumProcessors() - 1);
+    seedRandom(&Random, 1);
+
+    printf("\n threads: %d\n", Pool.numThreads + 1);
+    printf("\n %-10s %8s %8s %10s %12s %12s %8s\n", "board", "mines", "games", "positions", "average us",
+        "slowest us", "exact");
+
+    for (i = 0; i < 2; i++) {
+        numTiles = configurations[i][0] * configurations[i][1];
+        numPositions = 0;
+        numExact = 0;
+        totalTime = 0;
+        slowestTime = 0;
+
+        for (j = 0; j < configurations[i][3]; j++) {
+            if (!clearBoard(&Board, configurations[i][0], configurations[i][1]) ||
+                !placeMines(&Board, configurations[i][2], &Random, 0, 0)) return;
+            initializeTileStates(&Board);
+            revealTiles(&Board, 0, 0);
+
+            while (Board.numHiddenSafe > 0) {
+                if (solvePosition(&Board, &Solver, 0) > 0 && Solver.numSafe > 0) {
+                    for (k = 0; k < Solver.numSafe; k++) {
+                        revealTiles(&Board, Solver.safeCells[k] / Board.columns, Solver.safeCells[k] % Board.columns);
+                    }
+                    continue;
+                }
+
+                // stuck; this is where a player would want the chances
+                startTime = getMicroseconds();
+                if (!computeProbabilities(&Board, &Solver, &Map, &Pool)) break;
+                elapsed = getMicroseconds() - startTime;
+
+                totalTime += elapsed;
+                if (elapsed > slowestTime) slowestTime = elapsed;
+                numPositions++;
+                numExact += Map.isExact;
+
+                safest = -1;
+                for (k = 0; k < numTiles; k++) {
+                    if (getBit(Board.revealedPlane, k)) continue;
+                    if (safest < 0 || Map.mineChance[k] < Map.mineChance[safest]) safest = k;
+                }
+
+                tile = safest;
+                while (hasMine(&Board, tile) || getBit(Board.revealedPlane, tile)) {
+                    tile = getRandomBelow(&Random, numTiles);
+                }
+
+                revealTiles(&Board, tile / Board.columns, tile % Board.columns);
+            }
+        }
+
+        printf(" %4dx%-5d %8d %8d %10d %12.2f %12lld %7.1f%%\n", configurations[i][0], configurations[i][1],
+            configurations[i][2], configurations[i][3], numPositions,
+            numPositions > 0 ? (double) totalTime / numPositions : 0, slowestTime,
+            numPositions > 0 ? 100.0 * numExact / numPositions : 100);
+    }
+
+    freeThreadPool(&Pool);
+    freeProbabilityMap(&Map);
+    freeSolver(&Solver);
+    freeBoard(&Board);
 }
 
 
 /*
-    @brief: prints a player's statistics
-	
-	@param: CurrentProfile - pointer to Profile structure instance containing information to reflect
-        the necessary data on the statistics screen
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-
-    Precondition: Assumes the player's statistics is accurate.
+    @brief: times buildFrame on the classic difficulties and on a board far larger than the
+        console, drawn bordered and dense in a console of BENCH_SCREEN_ROWS x BENCH_SCREEN_COLUMNS,
+        without writing anything to the console. It prints the window drawn, and the size and build
+        time of a frame drawn in full, of a frame after a cursor move, and of a frame after an
+        inspection. Every frame is written with a single write, so its size is what the console has
+        to take in per key press.
 */
-void statisticsScreen(struct Profile *CurrentProfile, int theme) {
-    Sleep(SHORT_SLEEP);
-    system("cls");
-    
-    printf("\n");
-    printDivider();
-    printf("\n\n");
+void benchmarkRender() {
+    struct Board Board;
+    struct Solver Solver;
+    struct Frame Frame;
+    struct Random Random;
+    int i, j;
+    int isDense;
+    int numAttempts;
+    int currRow, currColumn;
+    int numMoves, numReveals;
+    long long moveBytes, revealBytes;
+    long long moveTime, revealTime;
+    long long startTime;
+
+    // rows, columns, and mines of each difficulty, then of a large board as dense as expert
+    int configurations[4][3] = {
+        {8, 8, 10},
+        {10, 15, 35},
+        {16, 30, 99},
+        {200, 400, 16500}
+    };
+
+    initializeBoard(&Board);
+    initializeSolver(&Solver);
+    initializeFrame(&Frame);
+
+    printf("\n %-9s %-9s %-7s %12s %12s %12s %12s %14s %12s\n", "board", "style", "window", "full bytes",
+        "full us", "move bytes", "move us", "inspect bytes", "inspect us");
+
+    for (i = 0; i < 4; i++) {
+        for (isDense = 0; isDense <= 1; isDense++) {
+            currRow = configurations[i][0] / 2;
+            currColumn = configurations[i][1] / 2;
+
+            if (!clearBoard(&Board, configurations[i][0], configurations[i][1])) return;
+
+            seedRandom(&Random, 1);
+
+            if (i < 3) {
+                generateNoGuessGame(&Board, &Solver, configurations[i][2], currRow, currColumn, 1, &numAttempts);
+            }
+            else { // far too large to make guess-free
+                if (!placeMines(&Board, configurations[i][2], &Random, currRow, currColumn)) return;
+                initializeTileStates(&Board);
+            }
+
+            revealTiles(&Board, currRow, currColumn);
+
+            freeFrame(&Frame);
+            Frame.View.isDense = isDense;
+            Frame.screenRows = BENCH_SCREEN_ROWS;
+            Frame.screenColumns = BENCH_SCREEN_COLUMNS;
+
+            startTime = getNanoseconds();
+            buildFrame(&Frame, &Board, currRow, currColumn, 1, "", "\n Navigate the game board with your arrow keys.");
+            startTime = getNanoseconds() - startTime;
+            printf(" %4dx%-4d %-9s %3dx%-3d %12d %12.3f", configurations[i][0], configurations[i][1],
+                isDense ? "dense" : "bordered", Frame.View.rows, Frame.View.columns, Frame.frameBytes, startTime / 1000.0);
+
+            numMoves = 0;
+            numReveals = 0;
+            moveBytes = 0;
+            revealBytes = 0;
+            moveTime = 0;
+            revealTime = 0;
+
+            // the cursor wanders the board and sometimes inspects the tile it is on
+            for (j = 0; j < 100000 && getGameState(&Board) == 0; j++) {
+                if (getRandomBelow(&Random, 20) == 0 && !hasMine(&Board, currRow * Board.columns + currColumn) &&
+                    !isTileRevealed(&Board, currRow, currColumn)) {
+                    revealTiles(&Board, currRow, currColumn);
+
+                    startTime = getNanoseconds();
+                    buildFrame(&Frame, &Board, currRow, currColumn, 1, "", "\n Navigate the game board with your arrow keys.");
+                    revealTime += getNanoseconds() - startTime;
+                    revealBytes += Frame.frameBytes;
+                    numReveals++;
+                }
+                else {
+                    switch (getRandomBelow(&Random, 4)) {
+                        case 0: if (currRow > 0) currRow--; break;
+                        case 1: if (currRow < Board.rows - 1) currRow++; break;
+                        case 2: if (currColumn > 0) currColumn--; break;
+                        default: if (currColumn < Board.columns - 1) currColumn++; break;
+                    }
+
+                    startTime = getNanoseconds();
+                    buildFrame(&Frame, &Board, currRow, currColumn, 1, "", "\n Navigate the game board with your arrow keys.");
+                    moveTime += getNanoseconds() - startTime;
+                    moveBytes += Frame.frameBytes;
+                    numMoves++;
+                }
+            }
+
+            printf(" %12.1f %12.3f %14.1f %12.3f\n", numMoves > 0 ? (double) moveBytes / numMoves : 0,
+                numMoves > 0 ? moveTime / 1000.0 / numMoves : 0, numReveals > 0 ? (double) revealBytes / numReveals : 0,
+                numReveals > 0 ? revealTime / 1000.0 / numReveals : 0);
+        }
+    }
+
+    freeFrame(&Frame);
+    freeSolver(&Solver);
+    freeBoard(&Board);
+}
 
-    printTitle(theme);
-    printf("\n\n");
 
-    printDivider();
-    printf("\n\n\n");
+/*
+    @brief: computes a 64-bit FNV-1a checksum of a board's tile states, revealed tiles, and flags;
+        two boards in the same position always have the same checksum
 
-    int month = CurrentProfile->creationDate / 1000000;
-    int day = CurrentProfile->creationDate / 10000 % 100;
-    int year = CurrentProfile->creationDate % 10000;
+    @param: Board - pointer to the board
 
-    float easyWinRate = getWinRate(CurrentProfile->EasyStats.won, CurrentProfile->EasyStats.lost);
-    float difficultWinRate = getWinRate(CurrentProfile->DifficultStats.won, CurrentProfile->DifficultStats.lost);
-    float customWinRate = getWinRate(CurrentProfile->CustomStats.won, CurrentProfile->CustomStats.lost);
+    @return: the checksum
+*/
+unsigned long long getBoardChecksum(struct Board *Board) {
+    unsigned long long checksum = 0xCBF29CE484222325ULL;
+    int i;
+    int numTiles = Board->rows * Board->columns;
 
-    int easyAverageSeconds = getAverageSeconds(CurrentProfile->EasyStats.totalSeconds,
-        CurrentProfile->EasyStats.won);
-    int difficultAverageSeconds = getAverageSeconds(CurrentProfile->DifficultStats.totalSeconds,
-        CurrentProfile->DifficultStats.won);
-    int customAverageSeconds = getAverageSeconds(CurrentProfile->CustomStats.totalSeconds,
-        CurrentProfile->CustomStats.won);
+    for (i = 0; i < numTiles; i++) {
+        checksum = (checksum ^ (Board->states[i] | getBit(Board->revealedPlane, i) << 4 |
+            getBit(Board->flaggedPlane, i) << 5)) * 0x100000001B3ULL;
+    }
 
-    printf(" -------------------------------------\n");
-    printf(" ----- Basic Profile Information -----\n");
-    printf(" -------------------------------------\n\n");
+    return checksum;
+}
 
-    printf(" Name: %s\n", CurrentProfile->name);
-    printf(" Date of Profile Creation: %02d/%02d/%d\n", month, day, year);
-    printf(" Lifetime Games Played: %d\n\n\n", CurrentProfile->lifetimeGames);
 
-    printf(" -----------------------------------\n");
-    printf(" ----- Classic Game Statistics -----\n");
-    printf(" -----------------------------------\n\n");
+/*
+    @brief: rebuilds the board of a logged game and plays its actions again without any input,
+        rendering, or waiting, then prints the resulting position
 
-    printf(" Easy Win Rate: %.2f %%\n", easyWinRate);
-    printf(" Easy Games Won Average Time: %d seconds\n", easyAverageSeconds);
-    printf(" Easy Games Won: %d\n", CurrentProfile->EasyStats.won);
-    printf(" Easy Games Lost: %d\n\n", CurrentProfile->EasyStats.lost);
+    @param: directory - path of the replay file
+    @param: repetitions - number of times the game is replayed; the average time is printed
 
-    printf(" Difficult Win Rate: %.2f %%\n", difficultWinRate);
-    printf(" Difficult Games Won Average Time: %d seconds\n", difficultAverageSeconds);
-    printf(" Difficult Games Won: %d\n", CurrentProfile->DifficultStats.won);
-    printf(" Difficult Games Lost: %d\n\n\n", CurrentProfile->DifficultStats.lost);
+    @return: 1 - game was replayed
+             0 - the replay or its level could not be loaded
+*/
+int replayGame(char directory[], int repetitions) {
+    struct ActionLog Log;
+    struct Board Board;
+    int i;
+    int isValid = 1;
+    int hasQuit = 0;
+    int isGenerated;
+    int numPlayed;
+    long long startTime, totalTime = 0;
+    struct Solver Solver;
+    struct UndoHistory History;
+
+    initializeActionLog(&Log);
+    initializeBoard(&Board);
+    initializeSolver(&Solver);
+    initializeUndoHistory(&History);
+
+    if (!loadActionLog(&Log, directory)) {
+        printf("Could not read the replay '%s'.\n", directory);
+        freeActionLog(&Log);
+        return 0;
+    }
 
-    printf(" ----------------------------------\n");
-    printf(" ----- Custom Game Statistics -----\n");
-    printf(" ----------------------------------\n\n");
+    for (i = 0; isValid && i < repetitions; i++) {
+        startTime = getMicroseconds();
 
-    printf(" Custom Win Rate: %.2f %%\n", customWinRate);
-    printf(" Custom Games Won Average Time: %d seconds\n", customAverageSeconds);
-    printf(" Custom Games Won: %d\n", CurrentProfile->CustomStats.won);
-    printf(" Custom Games Lost: %d\n\n\n", CurrentProfile->CustomStats.lost);
+        isValid = buildLogBoard(&Board, &Log);
 
-    printf(" ------------------------\n");
-    printf(" ----- Recent Games -----\n");
-    printf(" ------------------------\n\n");
+        if (isValid) {
+            isGenerated = strcmp(Log.level, "-") != 0; // only classic boards are generated at the first inspection
+            clearUndoHistory(&History);
 
-    if (CurrentProfile->RecentGame1.exists) { // recent game 1
-        printf("\n ----- Recent Game 1 -----\n");
-        printf("\n Mode: %s\n", CurrentProfile->RecentGame1.mode);
-        printf("\n Outcome: %s\n", CurrentProfile->RecentGame1.outcome);
-        printBoard(CurrentProfile->RecentGame1.Board, CurrentProfile->RecentGame1.rows,
-            CurrentProfile->RecentGame1.columns, -1, -1, theme);
+            numPlayed = playLogActions(&Board, &Solver, &History, &Log, &isGenerated);
+            hasQuit = numPlayed > 0 && Log.actions[numPlayed - 1].type == 'Q';
+        }
+
+        totalTime += getMicroseconds() - startTime;
+    }
+
+    if (!isValid) {
+        printf("Could not rebuild the board of the replay '%s'.\n", directory);
     }
     else {
-        printf(" %s has never played a game of Minesweeper.\n", CurrentProfile->name);
+        printf("mode %s\n", Log.mode);
+        printf("level %s\n", Log.level);
+        printf("board %dx%d\n", Log.rows, Log.columns);
+        printf("mines %d\n", Log.numMines);
+        printf("seed %llu\n", Log.seed);
+        printf("actions %d\n", Log.numActions);
+        printf("outcome %s\n", getGameState(&Board) == 1 ? WON_OUTCOME : getGameState(&Board) == 2 ?
+            LOST_OUTCOME : hasQuit ? QUIT_OUTCOME : "Ongoing");
+        printf("hidden_safe %d\n", Board.numHiddenSafe);
+        printf("played_ms %d\n", Log.numActions > 0 ? Log.actions[Log.numActions - 1].milliseconds : 0);
+        printf("replay_us %.3f\n", (double) totalTime / repetitions);
+        printf("checksum %016llx\n", getBoardChecksum(&Board));
     }
 
-    if (CurrentProfile->RecentGame2.exists) { // recent game 2
-        printf("\n\n ----- Recent Game 2 -----\n");
-        printf("\n Mode: %s\n", CurrentProfile->RecentGame2.mode);
-        printf("\n Outcome: %s\n", CurrentProfile->RecentGame2.outcome);
-        printBoard(CurrentProfile->RecentGame2.Board, CurrentProfile->RecentGame2.rows,
-            CurrentProfile->RecentGame2.columns, -1, -1, theme);
+    freeBoard(&Board);
+    freeSolver(&Solver);
+    freeUndoHistory(&History);
+    freeActionLog(&Log);
+    return isValid;
+}
+
+
+/*
+    @brief: plays one player's share of the games of a simulation. Runs as a task of a thread pool.
+
+    @param: context - pointer to the simulation
+    @param: index - index of the player
+*/
+void playSimulationShare(void *context, int index) {
+    struct Simulation *Simulation = context;
+    struct BotPlayer *Player = &Simulation->Players[index];
+    int numGames = Simulation->numGames / Simulation->numPlayers + (index < Simulation->numGames % Simulation->numPlayers);
+    int i;
+
+    if (Simulation->Level != NULL) {
+        if (!copyBoard(&Player->Board, Simulation->Level)) return;
     }
+    else if (!clearBoard(&Player->Board, Simulation->rows, Simulation->columns)) return;
 
-    if (CurrentProfile->RecentGame3.exists) { // recent game 3
-        printf("\n\n ----- Recent Game 3 -----\n");
-        printf("\n Mode: %s\n", CurrentProfile->RecentGame3.mode);
-        printf("\n Outcome: %s\n", CurrentProfile->RecentGame3.outcome);
-        printBoard(CurrentProfile->RecentGame3.Board, CurrentProfile->RecentGame3.rows,
-            CurrentProfile->RecentGame3.columns, -1, -1, theme);
+    for (i = 0; i < numGames; i++) {
+        playBotGame(Player, Simulation->Bot, Simulation->Level != NULL ? 0 : Simulation->numMines);
     }
+}
 
-    printf("\n\n");
-    printDivider();
-    printf("\n\n");
 
-    printf(" Press 'Enter' to return to the Main Menu. Press 'Delete' to reset %s's statistics.",
-        CurrentProfile->name);
+/*
+    @brief: plays the games of a simulation on a thread pool, one player per thread, each with its
+        own random stream, and adds up the players' totals into the simulation
 
-    if (getch() == 224 && getch() == 83) { // the user confirms resetting their statistics
-        printf("\n\n Are you sure you want to reset %s's statistics?\n", CurrentProfile->name);
-        
-        if (confirmAction()) {
-            initializeProfile(CurrentProfile, CurrentProfile->name);
+    @param: Simulation - pointer to the simulation; its level or classic dimensions, bot, number
+        of games, and number of players are set
 
-            Sleep(SHORT_SLEEP);
-            printf("\n Successful.");
-            Sleep(SHORT_SLEEP);
+    @return: the wall-clock time taken in microseconds; -1 if there was not enough memory
+*/
+long long runSimulation(struct Simulation *Simulation) {
+    struct ThreadPool Pool;
+    unsigned long long seed = getEntropySeed();
+    long long startTime, elapsed;
+    int i, j;
 
-            printf(" %s's statistics has been reset.", CurrentProfile->name);
-            Sleep(LONG_SLEEP);
-            
-            printf("\n\n");
-            pressEnter();
-        }
-        else {
-            statisticsScreen(CurrentProfile, theme);
+    Simulation->numPlayed = 0;
+    Simulation->numWon = 0;
+    Simulation->numMoves = 0;
+    memset(Simulation->phaseNanoseconds, 0, sizeof(Simulation->phaseNanoseconds));
+
+    Simulation->Players = malloc(Simulation->numPlayers * sizeof(struct BotPlayer));
+    if (Simulation->Players == NULL) return -1;
+
+    for (i = 0; i < Simulation->numPlayers; i++) {
+        initializeBotPlayer(&Simulation->Players[i], seed + i);
+    }
+
+    initializeThreadPool(&Pool, Simulation->numPlayers - 1);
+
+    startTime = getMicroseconds();
+    runTasks(&Pool, playSimulationShare, Simulation, Simulation->numPlayers);
+    elapsed = getMicroseconds() - startTime;
+
+    freeThreadPool(&Pool);
+
+    for (i = 0; i < Simulation->numPlayers; i++) {
+        Simulation->numPlayed += Simulation->Players[i].numGames;
+        Simulation->numWon += Simulation->Players[i].numWon;
+        Simulation->numMoves += Simulation->Players[i].numMoves;
+
+        for (j = 0; j < NUM_PHASES; j++) {
+            Simulation->phaseNanoseconds[j] += Simulation->Players[i].phaseNanoseconds[j];
         }
+
+        freeBotPlayer(&Simulation->Players[i]);
     }
+
+    free(Simulation->Players);
+    Simulation->Players = NULL;
+    return elapsed;
 }
 
 
 /*
-    @brief: Prints the all-time-leaderboard
-	
-	@param: CurrentLeaderboard - leaderboard structure containing necessary information to reflect
-        the all-time leaderboard
-	@param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
+    @brief: prints a win rate with its 95% Wilson confidence interval
+
+    @param: numWon - number of games won
+    @param: numGames - number of games played; more than 0
 */
-void leaderboardScreen(struct Leaderboard *CurrentLeaderboard, int theme) {
-    int i;
-    struct Records *EasyRecords = &CurrentLeaderboard->EasyRecords;
-    struct Records *DifficultRecords = &CurrentLeaderboard->DifficultRecords;
-    struct Records *CustomRecords = &CurrentLeaderboard->CustomRecords;
-    
-    Sleep(SHORT_SLEEP);
-    system("cls");
+void printWinRate(int numWon, int numGames) {
+    double rate = (double) numWon / numGames;
+    double z = 1.96;
+    double center = (rate + z * z / (2 * numGames)) / (1 + z * z / numGames);
+    double margin = z * sqrt(rate * (1 - rate) / numGames + z * z / (4.0 * numGames * numGames)) /
+        (1 + z * z / numGames);
+
+    printf("win_rate %.4f\n", rate);
+    printf("win_rate_95 %.4f %.4f\n", center - margin, center + margin);
+}
 
-    printf("\n");
-    printDivider();
-    printf("\n\n\n");
-	
-	printLeaderboard(theme);
-    printf("\n\n");
 
-    printDivider();
-    printf("\n\n\n");
+/*
+    @brief: plays a custom level many times with a bot on every processor and prints its win rate
+        with a 95% Wilson confidence interval, the games played per second, and the average
+        number of tiles inspected per game. Custom levels have fixed mines, so only the bot's
+        choices differ between games; each thread has its own random stream.
 
-    printf(" -------------------------\n");
-    printf(" ----- %s -----\n", EASY_MODE);
-    printf(" -------------------------\n\n");
+    @param: name - name of the level in the levels directory
+    @param: numGames - number of games to play
+    @param: botName - name of the bot; NULL for the default bot
 
-    if (EasyRecords->numRecords == 0) {
-        printf(" No easy game has been won to date.\n");
-    }
-    else {
-        for (i = 0; i < EasyRecords->numRecords; i++) {
-            printf(" %d.) %s | %d seconds\n", i + 1, EasyRecords->names[i], EasyRecords->times[i]);
-        }
+    @return: 1 - games were played
+             0 - the level or bot was not found, or there was not enough memory
+*/
+int estimateWinRate(char name[], int numGames, char botName[]) {
+    FILE *fp;
+    struct Board Level;
+    struct Simulation Simulation;
+    struct Bot *Bot = findBot(botName);
+    string100 directory;
+    long long elapsed;
+
+    if (Bot == NULL) {
+        printf("Unknown bot '%s'.\n", botName);
+        return 0;
     }
 
-    printf("\n\n ------------------------------\n");
-    printf(" ----- %s -----\n", DIFFICULT_MODE);
-    printf(" ------------------------------\n\n");
+    strcpy(directory, LEVELS_FOLDER);
+    strncat(directory, name, 100 - strlen(directory) - 4);
+    strcat(directory, ".txt");
 
-    if (DifficultRecords->numRecords == 0) {
-        printf(" No difficult game has been won to date.\n");
+    initializeBoard(&Level);
+    fp = fopen(directory, "r");
+
+    if (fp == NULL || !readLevel(&Level, fp) || !isValidLevel(&Level)) {
+        printf("Could not load the level '%s'.\n", name);
+        if (fp != NULL) fclose(fp);
+        freeBoard(&Level);
+        return 0;
     }
-    else {
-        for (i = 0; i < DifficultRecords->numRecords; i++) {
-            printf(" %d.) %s | %d seconds\n", i + 1, DifficultRecords->names[i], DifficultRecords->times[i]);
-        }
+
+    fclose(fp);
+    initializeTileStates(&Level);
+
+    Simulation.Level = &Level;
+    Simulation.Bot = Bot;
+    Simulation.numGames = numGames;
+    Simulation.numPlayers = getNumProcessors();
+    elapsed = runSimulation(&Simulation);
+
+    if (elapsed >= 0 && Simulation.numPlayed > 0) {
+        printf("level %s\n", name);
+        printf("board %dx%d\n", Level.rows, Level.columns);
+        printf("mines %d\n", Level.Mines.numMines);
+        printf("bot %s (%s)\n", Bot->name, Bot->description);
+        printf("threads %d\n", Simulation.numPlayers);
+        printf("games %d\n", Simulation.numPlayed);
+        printf("won %d\n", Simulation.numWon);
+        printWinRate(Simulation.numWon, Simulation.numPlayed);
+        printf("games_per_second %.0f\n", elapsed > 0 ? Simulation.numPlayed * 1000000.0 / elapsed : 0);
+        printf("average_moves %.2f\n", (double) Simulation.numMoves / Simulation.numPlayed);
     }
 
-    printf("\n\n ------------------\n");
-    printf(" ----- %s -----\n", CUSTOM_MODE);
-    printf(" ------------------\n\n");
+    freeBoard(&Level);
+    return elapsed >= 0 && Simulation.numPlayed > 0;
+}
 
-    if (CustomRecords->numRecords == 0) {
-        printf(" No custom game has been won to date.\n");
+
+/*
+    @brief: plays classic games headlessly with a bot, sharded across threads, and prints the
+        games and moves per second, the win rate, and the time spent generating boards, choosing
+        tiles, inspecting them, and checking the games' states. The games go through the same
+        generation, inspection, and state checks as gameHandler, with no input, output, or waiting.
+
+    @param: difficulty - "easy", "difficult", or "expert"
+    @param: numGames - number of games to play
+    @param: botName - name of the bot; NULL for the default bot
+    @param: numThreads - number of threads to play on; 0 for one per processor
+
+    @return: 1 - games were played
+             0 - the difficulty or bot was not found, or there was not enough memory
+*/
+int simulateGames(char difficulty[], int numGames, char botName[], int numThreads) {
+    struct Simulation Simulation;
+    struct Bot *Bot = findBot(botName);
+    char *phaseNames[NUM_PHASES] = {"generate", "choose", "reveal", "check"};
+    long long elapsed;
+    int i;
+
+    if (strcmp(difficulty, "easy") == 0) {
+        Simulation.rows = 8;
+        Simulation.columns = 8;
+        Simulation.numMines = 10;
+    }
+    else if (strcmp(difficulty, "difficult") == 0) {
+        Simulation.rows = 10;
+        Simulation.columns = 15;
+        Simulation.numMines = 35;
+    }
+    else if (strcmp(difficulty, "expert") == 0) {
+        Simulation.rows = 16;
+        Simulation.columns = 30;
+        Simulation.numMines = 99;
     }
     else {
-        for (i = 0; i < CustomRecords->numRecords; i++) {
-            printf(" %d.) %s | %d seconds\n", i + 1, CustomRecords->names[i], CustomRecords->times[i]);
-        }
+        printf("Unknown difficulty '%s'.\n", difficulty);
+        return 0;
     }
 
-    printf("\n\n");
-    printDivider();
-    printf("\n\n");
-
-    printf(" Press 'Enter' to return to the Main Menu. Press 'Delete' to reset the all-time leaderboard.");
-
-    if (getch() == 224 && getch() == 83) { // the user confirms resetting their statistics
-        printf("\n\n Are you sure you want to reset the all-time leaderboard?\n");
-        
-        if (confirmAction()) {
-            remove(LEADERBOARD_DIRECTORY);
-            loadLeaderboard(CurrentLeaderboard);
-
-            Sleep(SHORT_SLEEP);
-            printf("\n Successful.");
-            Sleep(SHORT_SLEEP);
+    if (Bot == NULL) {
+        printf("Unknown bot '%s'.\n", botName);
+        return 0;
+    }
 
-            printf(" The all-time leaderboard has been reset.");
-            Sleep(LONG_SLEEP);
-            
-            printf("\n\n");
-            pressEnter();
-        }
-        else {
-            leaderboardScreen(CurrentLeaderboard, theme);
-        }
+    Simulation.Level = NULL;
+    Simulation.Bot = Bot;
+    Simulation.numGames = numGames;
+    Simulation.numPlayers = numThreads > 0 ? numThreads : getNumProcessors();
+    elapsed = runSimulation(&Simulation);
+
+    if (elapsed < 0 || Simulation.numPlayed == 0) return 0;
+
+    printf("difficulty %s\n", difficulty);
+    printf("board %dx%d\n", Simulation.rows, Simulation.columns);
+    printf("mines %d\n", Simulation.numMines);
+    printf("bot %s (%s)\n", Bot->name, Bot->description);
+    printf("threads %d\n", Simulation.numPlayers);
+    printf("games %d\n", Simulation.numPlayed);
+    printf("moves %lld\n", Simulation.numMoves);
+    printf("won %d\n", Simulation.numWon);
+    printWinRate(Simulation.numWon, Simulation.numPlayed);
+    printf("seconds %.3f\n", elapsed / 1000000.0);
+    printf("games_per_second %.0f\n", elapsed > 0 ? Simulation.numPlayed * 1000000.0 / elapsed : 0);
+    printf("moves_per_second %.0f\n", elapsed > 0 ? Simulation.numMoves * 1000000.0 / elapsed : 0);
+
+    // phase times are summed over every thread, so they add up to about threads * seconds
+    for (i = 0; i < NUM_PHASES; i++) {
+        printf("phase_%s_seconds %.3f\n", phaseNames[i], Simulation.phaseNanoseconds[i] / 1000000000.0);
+        printf("phase_%s_ns_per_game %.0f\n", phaseNames[i], (double) Simulation.phaseNanoseconds[i] / Simulation.numPlayed);
     }
+
+    return 1;
 }
 
 
 /*
-    @brief: prints the termination sequence
-
-    @param: theme - integer that dictates the color (cyan/bright red/bright green/purple)
-*/
-void terminationSequence(int theme) {
-    Sleep(SHORT_SLEEP);
-    system("cls");
+    @brief: runs a non-interactive command given on the command line instead of the menus
 
-    Sleep(SHORT_SLEEP);
-    printEnd(theme);
-    Sleep(LONG_SLEEP);
-    
-    printf("\n Thank you for trying out our Minesweeper program! :D");
+    @param: argc - number of command-line arguments, not counting the options before the command
+    @param: argv - the program name followed by the command's arguments; argv[1] names the command
 
-    Sleep(LONG_SLEEP);
-    printf("\n - CJ & Andre");
+    @return: 0 - command ran successfully
+             1 - unknown command, or the command failed
+*/
+int commandHandler(int argc, char *argv[]) {
+    if (strcmp(argv[1], "--bench-reveal") == 0) {
+        benchmarkReveal();
+        return 0;
+    }
+    if (strcmp(argv[1], "--bench-generate") == 0) {
+        benchmarkGenerate();
+        return 0;
+    }
+    if (strcmp(argv[1], "--bench-init") == 0) {
+        benchmarkInitialize();
+        return 0;
+    }
+    if (strcmp(argv[1], "--bench-noguess") == 0) {
+        benchmarkNoGuess();
+        return 0;
+    }
+    if (strcmp(argv[1], "--bench-solve") == 0) {
+        benchmarkSolve();
+        return 0;
+    }
+    if (strcmp(argv[1], "--bench-probability") == 0) {
+        benchmarkProbabilities();
+        return 0;
+    }
+    if (strcmp(argv[1], "--bench-render") == 0) {
+        benchmarkRender();
+        return 0;
+    }
+    if (strcmp(argv[1], "--winrate") == 0 && argc >= 4 && atoi(argv[3]) > 0) {
+        return !estimateWinRate(argv[2], atoi(argv[3]), argc >= 5 ? argv[4] : NULL);
+    }
+    if (strcmp(argv[1], "--simulate") == 0 && argc >= 4 && atoi(argv[3]) > 0) {
+        return !simulateGames(argv[2], atoi(argv[3]), argc >= 5 ? argv[4] : NULL, argc >= 6 ? atoi(argv[5]) : 0);
+    }
+    if (strcmp(argv[1], "--replay") == 0 && argc >= 3) {
+        return !replayGame(argv[2], argc >= 4 && atoi(argv[3]) > 0 ? atoi(argv[3]) : 1);
+    }
 
-    Sleep(LONG_SLEEP);
-    printf("\n");
+    printf("Unknown command '%s'.\n\n", argv[1]);
+    printf("Usage: %s [--no-pacing] [--dense] [--latency] [--seed <n>] [--batch <script | -> | <command>]\n\n"
+        "Commands: --bench-reveal | --bench-generate | --bench-init | --bench-noguess |\n    --bench-solve | --bench-probability | --bench-render |\n    --replay <file> [repetitions] | --winrate <level> <games> [probability | logic | random] |\n    --simulate <easy | difficult | expert> <games> [probability | logic | random] [threads]\n", argv[0]);
+    return 1;
 }
 
 
@@ -2685,26 +9979,67 @@ void terminationSequence(int theme) {
         generation, profile handling, etc.), prints the corresponding outputs, then terminates the
         program upon completion/termination.
 
+    @param: argc - number of command-line arguments
+    @param: argv - the command-line arguments; when a command is given, it runs instead of the menus
+
     @return: 0 for successful execution; otherwise, a non-zero value corresponding to the error.
 
 */
-int main() {
-	srand(time(NULL)); // initializes rand() using system time
+int main(int argc, char *argv[]) {
+    char *script = NULL;
+    int i;
+
+    for (i = 1; i < argc; i++) { // options of the game; anything else is a command
+        if (strcmp(argv[i], "--no-pacing") == 0) isPacing = 0; // the menus never pause
+        else if (strcmp(argv[i], "--dense") == 0) isDenseBoard = 1; // boards are drawn one character per tile
+        else if (strcmp(argv[i], "--latency") == 0) isReportingLatency = 1; // the latencies are printed on exit
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) { // games and themes are the same on every run
+            isSeeded = 1;
+            fixedSeed = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) script = argv[++i]; // the menus are answered from a script
+        else { // the options before the command are dropped, so that it reads its own arguments
+            initializeConsole();
+            prepareGlyphTable();
 
-	int theme = getRandInt(1, 4); // randomize program theme
+            argv[i - 1] = argv[0];
+            return commandHandler(argc - i + 1, argv + i - 1);
+        }
+    }
+
+    if (script != NULL) { // the console is left as it is, as nothing is drawn on it
+        if (!startBatch(script)) {
+            printf("Cannot start a batch session from '%s'.\n", script);
+            return 1;
+        }
+    }
+    else {
+        initializeConsole();
+    }
+    prepareGlyphTable(); // composed once here rather than at the first board drawn
+
+    struct Random ProgramRandom;
+    seedRandom(&ProgramRandom, getEntropySeed()); // only picks themes; every game seeds its own generator
+
+	int theme = getRandInt(&ProgramRandom, 1, 4); // randomize program theme
     int programIsRunning = 1;
     char userResponse;
 
     struct Profile CurrentProfile;
     struct Leaderboard CurrentLeaderboard;
 
+    initializeBoard(&CurrentProfile.CurrentGame.Board);
+    initializeBoard(&CurrentProfile.RecentGame1.Board);
+    initializeBoard(&CurrentProfile.RecentGame2.Board);
+    initializeBoard(&CurrentProfile.RecentGame3.Board);
+
     CurrentProfile.creationDate = getDateCode();
     initializeProfile(&CurrentProfile, "GUEST");
     initializeLeaderboard(&CurrentLeaderboard);
     loadLeaderboard(&CurrentLeaderboard);
 
-    system("cls");
-    Sleep(SHORT_SLEEP);
+    clearScreen();
+    pace(SHORT_SLEEP);
 
     printTitle(theme);
     printf("\n\n\x1b[1m\x1b[37m                      A CCPROG2 project by Christian Joseph Bunyi and Andre Gabriel Llanes.\x1b[0m\n\n");
@@ -2714,9 +10049,8 @@ int main() {
     profileHandler(&CurrentProfile, theme);
 
     while (programIsRunning) {
-        do {
-            Sleep(SHORT_SLEEP);
-            system("cls");
+        do { // every screen that returns here has already paused for its last message
+            clearScreen();
 
             printf("\n");
             printDivider();
@@ -2758,20 +10092,20 @@ int main() {
         }
         else if (userResponse == 'g') { // Reroll
             printf("\n Rolling.");
-            Sleep(SHORT_SLEEP);
+            pace(SHORT_SLEEP);
 
             printf(".");
-            Sleep(SHORT_SLEEP);
+            pace(SHORT_SLEEP);
 
             printf(".");
-            Sleep(LONG_SLEEP);
+            pace(LONG_SLEEP);
 
-            theme = getRandInt(1, 4);
+            theme = getRandInt(&ProgramRandom, 1, 4);
             printf(" You rolled a %d!", theme);
-            Sleep(SHORT_SLEEP);
+            pace(SHORT_SLEEP);
         }
         else if (userResponse == 'h') { // Quit
-            Sleep(SHORT_SLEEP);
+            pace(SHORT_SLEEP);
             printf("\n Are you sure you want to quit?\n");
 
             if (confirmAction()) { // user confirms quitting
@@ -2781,6 +10115,12 @@ int main() {
     }
 
     terminationSequence(theme);
+    if (isBatch) endBatch("quit");
+
+    if (isReportingLatency) {
+        printf("\n");
+        printLatencyReport();
+    }
 
     return 0;
 }